@@ -48,7 +48,14 @@ static const Register rlocals  = LP64_ONLY(r14) NOT_LP64(rdi);
 
 // Platform-dependent initialization
 void TemplateTable::pd_initialize() {
-  // No x86 specific initialization
+  const int ubcp = 1 << Template::uses_bcp_bit;
+  const int disp = 1 << Template::does_dispatch_bit;
+  const int clvm = 1 << Template::calls_vm_bit;
+  def(Bytecodes::_fast_iload_if_icmp  , ubcp|disp|clvm, vtos, vtos, fast_iload_if_icmp, -1);
+  def(Bytecodes::_fast_iload_0_if_icmp, ubcp|disp|clvm, vtos, vtos, fast_iload_if_icmp,  0);
+  def(Bytecodes::_fast_iload_1_if_icmp, ubcp|disp|clvm, vtos, vtos, fast_iload_if_icmp,  1);
+  def(Bytecodes::_fast_iload_2_if_icmp, ubcp|disp|clvm, vtos, vtos, fast_iload_if_icmp,  2);
+  def(Bytecodes::_fast_iload_3_if_icmp, ubcp|disp|clvm, vtos, vtos, fast_iload_if_icmp,  3);
 }
 
 // Address Computation: local variables
@@ -2392,6 +2399,58 @@ void TemplateTable::if_icmp(Condition cc) {
   __ profile_not_taken_branch(rax);
 }
 
+// iload, iload, if_icmp<cond> fused by the Rewriter. n is the local of a
+// first iload_<n>, or -1 for a first iload with an index operand. The
+// second load and the condition are decoded from the bytecodes that follow.
+void TemplateTable::fast_iload_if_icmp(int n) {
+  transition(vtos, vtos);
+  const int first_length = n < 0 ? Bytecodes::length_for(Bytecodes::_iload) : 1;
+  Label short_second, compare, not_taken;
+  if (n < 0) {
+    locals_index(rbx);
+    __ movl(rdx, iaddress(rbx));
+  } else {
+    __ movl(rdx, iaddress(n));
+  }
+  // The second load is an iload (possibly rewritten to fast_iload) or
+  // an iload_<m>
+  __ load_unsigned_byte(rbx, at_bcp(first_length));
+  __ subl(rbx, Bytecodes::_iload_0);
+  __ cmpl(rbx, 3);
+  __ jcc(Assembler::belowEqual, short_second);
+  locals_index(rbx, first_length + 1);
+  __ movl(rax, iaddress(rbx));
+  __ addptr(rbcp, first_length + Bytecodes::length_for(Bytecodes::_iload));
+  __ jmp(compare);
+  __ bind(short_second);
+  __ negptr(rbx);
+  __ movl(rax, iaddress(rbx));
+  __ addptr(rbcp, first_length + 1);
+  // Continue at the if_icmp<cond>: the branch offset, the profile data
+  // and the bci reported for the backedge counter overflow belong to it.
+  __ bind(compare);
+  // Encode the outcome of the compare as 4 (less), 2 (equal) or 1 (greater)
+  // and test it against the outcomes the condition branches on, packed as
+  // 3 bit fields in if_icmpeq .. if_icmple order.
+  const int taken_outcomes = (2 << 0) | (5 << 3) | (4 << 6) | (3 << 9) | (1 << 12) | (6 << 15);
+  __ cmpl(rdx, rax);
+  __ movl(rax, 2);
+  __ movl(rdx, 4);
+  __ cmov32(Assembler::less, rax, rdx);
+  __ movl(rdx, 1);
+  __ cmov32(Assembler::greater, rax, rdx);
+  __ load_unsigned_byte(rcx, at_bcp(0));
+  __ subl(rcx, Bytecodes::_if_icmpeq);
+  __ lea(rcx, Address(rcx, rcx, Address::times_2));
+  __ shll(rax);
+  __ testl(rax, taken_outcomes);
+  __ jcc(Assembler::zero, not_taken);
+  branch(false, false);
+  __ bind(not_taken);
+  __ profile_not_taken_branch(rax);
+  __ dispatch_next(vtos, Bytecodes::length_for(Bytecodes::_if_icmpeq));
+}
+
 void TemplateTable::if_nullcmp(Condition cc) {
   transition(atos, vtos);
   // assume branch is more often taken than not (loops use backward branches)
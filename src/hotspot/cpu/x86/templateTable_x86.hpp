@@ -39,4 +39,7 @@
   static void index_check(Register array, Register index);
   static void index_check_without_pop(Register array, Register index);
 
+  // Fused bytecodes
+  static void fast_iload_if_icmp(int n);
+
 #endif // CPU_X86_VM_TEMPLATETABLE_X86_HPP
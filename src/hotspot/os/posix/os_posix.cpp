@@ -44,6 +44,7 @@
 #include <sys/mman.h>
 #include <sys/resource.h>
 #include <sys/utsname.h>
+#include <sys/wait.h>
 #include <time.h>
 #include <unistd.h>
 #include <utmpx.h>
@@ -353,6 +354,42 @@ int os::vsnprintf(char* buf, size_t len, const char* fmt, va_list args) {
   return result;
 }
 
+// Darwin has no "environ" in a dynamic library.
+#ifdef __APPLE__
+  #include <crt_externs.h>
+  #define environ (*_NSGetEnviron())
+#else
+extern char** environ;
+#endif
+
+// Run argv[0] with the arguments argv in a separate process, without a
+// shell. Return its exit value, or -1 on failure.
+int os::fork_and_exec(char* const argv[]) {
+  pid_t pid = fork();
+  if (pid < 0) {
+    return -1;
+  } else if (pid == 0) {
+    execve(argv[0], argv, environ);
+    _exit(-1);
+  }
+
+  int status;
+  while (waitpid(pid, &status, 0) < 0) {
+    switch (errno) {
+    case ECHILD: return 0;
+    case EINTR: break;
+    default: return -1;
+    }
+  }
+  if (WIFEXITED(status)) {
+    return WEXITSTATUS(status);
+  } else if (WIFSIGNALED(status)) {
+    return 0x80 + WTERMSIG(status);
+  } else {
+    return status;
+  }
+}
+
 int os::get_fileno(FILE* fp) {
   return NOT_AIX(::)fileno(fp);
 }
@@ -5562,6 +5562,53 @@ int os::fork_and_exec(char* cmd, bool use_vfork_if_available) {
   return (int)exit_code;
 }
 
+// Run argv[0] with the arguments argv in a separate process, without
+// cmd.exe. Return its exit value, or -1 on failure.
+int os::fork_and_exec(char* const argv[]) {
+  // Quote every argument, the arguments are not expected to contain quotes.
+  size_t len = 1;
+  for (int i = 0; argv[i] != NULL; i++) {
+    len += strlen(argv[i]) + 3;
+  }
+  char* cmd_string = NEW_C_HEAP_ARRAY_RETURN_NULL(char, len, mtInternal);
+  if (cmd_string == NULL) {
+    return -1;
+  }
+  cmd_string[0] = '\0';
+  for (int i = 0; argv[i] != NULL; i++) {
+    strcat(cmd_string, i == 0 ? "\"" : " \"");
+    strcat(cmd_string, argv[i]);
+    strcat(cmd_string, "\"");
+  }
+
+  STARTUPINFO si;
+  PROCESS_INFORMATION pi;
+  DWORD exit_code;
+  memset(&si, 0, sizeof(si));
+  si.cb = sizeof(si);
+  memset(&pi, 0, sizeof(pi));
+  BOOL rslt = CreateProcess(argv[0],       // executable name
+                            cmd_string,    // command line
+                            NULL,   // process security attribute
+                            NULL,   // thread security attribute
+                            TRUE,   // inherits system handles
+                            0,      // no creation flags
+                            NULL,   // use parent's environment block
+                            NULL,   // use parent's starting directory
+                            &si,    // (in) startup information
+                            &pi);   // (out) process information
+  if (rslt) {
+    WaitForSingleObject(pi.hProcess, INFINITE);
+    GetExitCodeProcess(pi.hProcess, &exit_code);
+    CloseHandle(pi.hProcess);
+    CloseHandle(pi.hThread);
+  } else {
+    exit_code = -1;
+  }
+  FREE_C_HEAP_ARRAY(char, cmd_string);
+  return (int)exit_code;
+}
+
 bool os::find(address addr, outputStream* st) {
   int offset = -1;
   bool result = false;
@@ -40,6 +40,7 @@
 #include "oops/oop.inline.hpp"
 #include "runtime/sharedRuntime.hpp"
 #include "runtime/compilationPolicy.hpp"
+#include "runtime/deoptimization.hpp"
 #include "runtime/vm_version.hpp"
 #include "utilities/bitMap.inline.hpp"
 
@@ -2017,6 +2018,36 @@ void GraphBuilder::invoke(Bytecodes::Code code) {
     }
   }
 
+  // Neither the static type nor CHA found a single target: if the
+  // receiver type profile says the call site is monomorphic, guard on
+  // the profiled receiver klass (deoptimizing on a mismatch) and bind
+  // the call to the profiled target.
+  ciKlass* profiled_receiver_klass = NULL;
+  if (C1ProfileGuidedInlining && DeoptC1 && !PatchALot && will_link && target->is_loaded() &&
+      cha_monomorphic_target == NULL && exact_target == NULL && !patch_for_appendix &&
+      (code == Bytecodes::_invokevirtual || code == Bytecodes::_invokeinterface) &&
+      !target->is_method_handle_intrinsic() && !target->is_compiled_lambda_form()) {
+    ciInstanceKlass* profiled_klass = NULL;
+    // The call site and its profile belong to the method being parsed,
+    // which is the inlinee when this call is in an inlined method.
+    ciMethod* profiled_target = profiled_monomorphic_target(method(), bci(), target, calling_klass,
+                                                            actual_recv, profiled_klass);
+    if (profiled_target != NULL) {
+      int index = state()->stack_size() - (target->arg_size_no_receiver() + 1);
+      Value receiver = state()->stack_at(index);
+      CheckCast* c = new CheckCast(profiled_klass, receiver, copy_state_before());
+      c->set_profiled_receiver_check();
+      c->set_direct_compare(true);
+      better_receiver = append_split(c);
+      exact_target = profiled_target;
+      target = profiled_target;
+      code = Bytecodes::_invokespecial;
+      // The guard pins the receiver to profiled_klass, which may be a
+      // subclass of the holder of an inherited profiled_target.
+      profiled_receiver_klass = profiled_klass;
+    }
+  }
+
   if (cha_monomorphic_target != NULL) {
     assert(!target->can_be_statically_bound() || target == cha_monomorphic_target, "");
     assert(!cha_monomorphic_target->is_abstract(), "");
@@ -2042,7 +2073,7 @@ void GraphBuilder::invoke(Bytecodes::Code code) {
         code == Bytecodes::_invokedynamic) {
       ciMethod* inline_target = (cha_monomorphic_target != NULL) ? cha_monomorphic_target : target;
       // static binding => check if callee is ok
-      bool success = try_inline(inline_target, (cha_monomorphic_target != NULL) || (exact_target != NULL), false, code, better_receiver);
+      bool success = try_inline(inline_target, (cha_monomorphic_target != NULL) || (exact_target != NULL), false, code, better_receiver, profiled_receiver_klass);
 
       CHECK_BAILOUT();
       clear_inline_bailout();
@@ -2134,6 +2165,8 @@ void GraphBuilder::invoke(Bytecodes::Code code) {
         ciKlass* target_klass = NULL;
         if (cha_monomorphic_target != NULL) {
           target_klass = cha_monomorphic_target->holder();
+        } else if (profiled_receiver_klass != NULL) {
+          target_klass = profiled_receiver_klass;
         } else if (exact_target != NULL) {
           target_klass = exact_target->holder();
         }
@@ -2183,6 +2216,45 @@ void GraphBuilder::new_object_array() {
 }
 
 
+// Returns the target of the call site at caller_bci in caller whose
+// receiver type profile saw a single receiver klass, or NULL. The receiver
+// klass is returned in profiled_klass. Call sites that already failed such a
+// receiver check (see Runtime1::deoptimize) are not speculated on again, nor
+// are methods that failed too many of them.
+ciMethod* GraphBuilder::profiled_monomorphic_target(ciMethod* caller, int caller_bci, ciMethod* target,
+                                                    ciInstanceKlass* calling_klass, ciInstanceKlass* actual_recv,
+                                                    ciInstanceKlass*& profiled_klass) {
+#if !COMPILER2_OR_JVMCI
+  // Traps are not recorded in the MethodData, so a failing guard would
+  // be compiled in again and again.
+  return NULL;
+#endif
+  ciMethodData* md = caller->method_data_or_null();
+  if (md == NULL || md->has_trap_at(caller_bci, NULL, Deoptimization::Reason_class_check) != 0 ||
+      md->trap_count(Deoptimization::Reason_class_check) >= (uint)PerMethodTrapLimit) {
+    return NULL;
+  }
+  ciCallProfile profile = caller->call_profile_at_bci(caller_bci);
+  if (profile.morphism() != 1 || profile.count() < C1ProfileGuidedInliningMinCount) {
+    return NULL;
+  }
+  ciKlass* receiver = profile.receiver(0);
+  if (receiver == NULL || !receiver->is_loaded() || !receiver->is_instance_klass()) {
+    return NULL;
+  }
+  ciInstanceKlass* ik = receiver->as_instance_klass();
+  if (ik->is_interface() || !ik->is_initialized() || !ik->is_subtype_of(actual_recv)) {
+    return NULL;
+  }
+  ciMethod* profiled_target = target->resolve_invoke(calling_klass, ik);
+  if (profiled_target == NULL || !profiled_target->is_loaded() || profiled_target->is_abstract()) {
+    return NULL;
+  }
+  profiled_klass = ik;
+  return profiled_target;
+}
+
+
 bool GraphBuilder::direct_compare(ciKlass* k) {
   if (k->is_loaded() && k->is_instance_klass() && !UseSlowPath) {
     ciInstanceKlass* ik = k->as_instance_klass();
@@ -3416,7 +3488,7 @@ int GraphBuilder::recursive_inline_level(ciMethod* cur_callee) const {
 }
 
 
-bool GraphBuilder::try_inline(ciMethod* callee, bool holder_known, bool ignore_return, Bytecodes::Code bc, Value receiver) {
+bool GraphBuilder::try_inline(ciMethod* callee, bool holder_known, bool ignore_return, Bytecodes::Code bc, Value receiver, ciKlass* known_receiver_klass) {
   const char* msg = NULL;
 
   // clear out any existing inline bailout condition
@@ -3464,7 +3536,7 @@ bool GraphBuilder::try_inline(ciMethod* callee, bool holder_known, bool ignore_r
   if (bc == Bytecodes::_illegal) {
     bc = code();
   }
-  if (try_inline_full(callee, holder_known, ignore_return, bc, receiver)) {
+  if (try_inline_full(callee, holder_known, ignore_return, bc, receiver, known_receiver_klass)) {
     if (callee->has_reserved_stack_access()) {
       compilation()->set_has_reserved_stack_access(true);
     }
@@ -3773,7 +3845,7 @@ void GraphBuilder::fill_sync_handler(Value lock, BlockBegin* sync_handler, bool
 }
 
 
-bool GraphBuilder::try_inline_full(ciMethod* callee, bool holder_known, bool ignore_return, Bytecodes::Code bc, Value receiver) {
+bool GraphBuilder::try_inline_full(ciMethod* callee, bool holder_known, bool ignore_return, Bytecodes::Code bc, Value receiver, ciKlass* known_receiver_klass) {
   assert(!callee->is_native(), "callee must not be native");
   if (CompilationPolicy::policy()->should_not_inline(compilation()->env(), callee)) {
     INLINE_BAILOUT("inlining prohibited by policy");
@@ -3887,7 +3959,11 @@ bool GraphBuilder::try_inline_full(ciMethod* callee, bool holder_known, bool ign
         }
         check_args_for_profiling(obj_args, s);
       }
-      profile_call(callee, recv, holder_known ? callee->holder() : NULL, obj_args, true);
+      ciKlass* known_klass = known_receiver_klass;
+      if (known_klass == NULL && holder_known) {
+        known_klass = callee->holder();
+      }
+      profile_call(callee, recv, known_klass, obj_args, true);
     }
   }
 
@@ -787,6 +787,20 @@ JRT_ENTRY(void, Runtime1::deoptimize(JavaThread* thread, jint trap_request))
         if (trap_mdo != NULL) {
           trap_mdo->inc_tenure_traps();
         }
+      } else if (reason == Deoptimization::Reason_class_check) {
+        // A failed profiled receiver guard (-XX:+C1ProfileGuidedInlining):
+        // record the trap at the call site, in the possibly inlined method
+        // that holds it, so the next compilation doesn't speculate there.
+        ScopeDesc* sd = nm->scope_desc_at(caller_frame.pc());
+        methodHandle trap_method(thread, sd->method());
+        MethodData* trap_mdo = Deoptimization::get_method_data(thread, trap_method, true /*create_if_missing*/);
+        if (trap_mdo != NULL) {
+          Deoptimization::update_method_data_from_interpreter(trap_mdo, sd->bci(), reason);
+        }
+        MethodData* mdo = Deoptimization::get_method_data(thread, method, true /*create_if_missing*/);
+        if (mdo != NULL) {
+          mdo->inc_decompile_count();
+        }
       }
     }
   }
@@ -309,6 +309,15 @@
   product(bool, C1ProfileInlinedCalls, true,                                \
           "Profile inlined calls when generating code for updating MDOs")   \
                                                                             \
+  product(bool, C1ProfileGuidedInlining, false,                             \
+          "Bind and inline virtual calls whose receiver type profile is "   \
+          "monomorphic behind a klass guard that deoptimizes")              \
+                                                                            \
+  product(intx, C1ProfileGuidedInliningMinCount, 1000,                      \
+          "Minimum number of profiled calls for a call site to be bound "   \
+          "to its profiled receiver")                                       \
+          range(0, max_jint)                                                \
+                                                                            \
   product(bool, C1ProfileBranches, true,                                    \
           "Profile branches when generating code for updating MDOs")        \
                                                                             \
@@ -398,9 +398,8 @@ ciField* ciInstanceKlass::get_field_by_offset(int field_offset, bool is_static)
       int  field_off = field->offset_in_bytes();
       if (field_off == field_offset)
         return field;
-      if (field_off > field_offset)
-        break;
-      // could do binary search or check bins, but probably not worth it
+      // Fields are sorted by offset per class only, so scan all of them:
+      // a subclass field may be placed in a gap of the super's layout.
     }
     return NULL;
   }
@@ -449,21 +448,15 @@ int ciInstanceKlass::compute_nonstatic_fields() {
   }
   assert(!is_java_lang_Object(), "bootstrap OK");
 
-  // Size in bytes of my fields, including inherited fields.
-  int fsize = nonstatic_field_size() * heapOopSize;
-
+  // Don't take the super's fields just because the size is the same:
+  // with -XX:+CompactFieldsInSuperGaps my fields may all be placed in gaps
+  // of the super's layout.
   ciInstanceKlass* super = this->super();
   GrowableArray<ciField*>* super_fields = NULL;
   if (super != NULL && super->has_nonstatic_fields()) {
-    int super_fsize  = super->nonstatic_field_size() * heapOopSize;
     int super_flen   = super->nof_nonstatic_fields();
     super_fields = super->_nonstatic_fields;
     assert(super_flen == 0 || super_fields != NULL, "first get nof_fields");
-    // See if I am no larger than my super; if so, I can use his fields.
-    if (fsize == super_fsize) {
-      _nonstatic_fields = super_fields;
-      return super_fields->length();
-    }
   }
 
   GrowableArray<ciField*>* fields = NULL;
@@ -481,13 +474,8 @@ int ciInstanceKlass::compute_nonstatic_fields() {
     }
   }
 
-  int flen = fields->length();
-
-  // Now sort them by offset, ascending.
-  // (In principle, they could mix with superclass fields.)
-  fields->sort(sort_field_by_offset);
   _nonstatic_fields = fields;
-  return flen;
+  return fields->length();
 }
 
 GrowableArray<ciField*>*
@@ -507,6 +495,19 @@ ciInstanceKlass::compute_nonstatic_fields_impl(GrowableArray<ciField*>*
   if (flen == 0) {
     return NULL;  // return nothing if none are locally declared
   }
+  GrowableArray<ciField*>* local_fields = new (arena) GrowableArray<ciField*>(arena, flen, 0, NULL);
+  for (JavaFieldStream fs(k); !fs.done(); fs.next()) {
+    if (fs.access_flags().is_static())  continue;
+    fieldDescriptor& fd = fs.field_descriptor();
+    ciField* field = new (arena) ciField(&fd);
+    local_fields->append(field);
+  }
+  // Sort the local fields by offset, ascending, and keep them after the
+  // super's fields. Local fields may mix with the super's fields in the
+  // layout (-XX:+CompactFieldsInSuperGaps), but deoptimization restores the
+  // fields of scalar replaced objects class by class in this order.
+  local_fields->sort(sort_field_by_offset);
+
   if (super_fields != NULL) {
     flen += super_fields->length();
   }
@@ -514,13 +515,7 @@ ciInstanceKlass::compute_nonstatic_fields_impl(GrowableArray<ciField*>*
   if (super_fields != NULL) {
     fields->appendAll(super_fields);
   }
-
-  for (JavaFieldStream fs(k); !fs.done(); fs.next()) {
-    if (fs.access_flags().is_static())  continue;
-    fieldDescriptor& fd = fs.field_descriptor();
-    ciField* field = new (arena) ciField(&fd);
-    fields->append(field);
-  }
+  fields->appendAll(local_fields);
   assert(fields->length() == flen, "sanity");
   return fields;
 }
@@ -29,6 +29,7 @@
 #include "ci/ciSymbol.hpp"
 #include "ci/ciKlass.hpp"
 #include "ci/ciUtilities.inline.hpp"
+#include "code/nmethod.hpp"
 #include "compiler/compileBroker.hpp"
 #include "memory/allocation.inline.hpp"
 #include "memory/oopFactory.hpp"
@@ -36,6 +37,7 @@
 #include "oops/method.inline.hpp"
 #include "oops/oop.inline.hpp"
 #include "runtime/fieldDescriptor.inline.hpp"
+#include "runtime/timer.hpp"
 #include "utilities/copy.hpp"
 #include "utilities/macros.hpp"
 
@@ -562,12 +564,39 @@ class CompileReplay : public StackObj {
       nm->make_not_entrant();
     }
     replay_state = this;
+    elapsedTimer time;
+    julong arena_bytes = Arena::bytes_allocated();
+    time.start();
     CompileBroker::compile_method(method, entry_bci, comp_level,
                                   methodHandle(), 0, CompileTask::Reason_Replay, THREAD);
+    time.stop();
+    arena_bytes = Arena::bytes_allocated() - arena_bytes;
     replay_state = NULL;
+    print_result(method, entry_bci, comp_level, time, arena_bytes);
     reset();
   }
 
+  // Report the cost and outcome of the replayed compilation in one line,
+  // for launchers replaying many compilations:
+  //
+  // ReplayResult <method> <entry_bci> <comp_level> time_us=# arena_bytes=# insts_size=# total_size=#
+  //
+  // The sizes are -1 if the compilation failed. The compile runs in the
+  // foreground, so the arena bytes are those of the compilation plus
+  // little noise from other threads.
+  void print_result(Method* method, int entry_bci, int comp_level, elapsedTimer time, julong arena_bytes) {
+    CompiledMethod* nm = (entry_bci != InvocationEntryBci) ? method->lookup_osr_nmethod_for(entry_bci, comp_level, true) : method->code();
+    int insts_size = -1;
+    int total_size = -1;
+    if (nm != NULL && nm->is_nmethod() && nm->comp_level() == comp_level) {
+      insts_size = nm->insts_size();
+      total_size = ((nmethod*)nm)->total_size();
+    }
+    tty->print_cr("ReplayResult %s %d %d time_us=" JLONG_FORMAT " arena_bytes=" JULONG_FORMAT " insts_size=%d total_size=%d",
+                  method->name_and_sig_as_C_string(), entry_bci, comp_level,
+                  (jlong)(time.seconds() * 1000000), arena_bytes, insts_size, total_size);
+  }
+
   // ciMethod <klass> <name> <signature> <invocation_counter> <backedge_counter> <interpreter_invocation_count> <interpreter_throwout_count> <instructions_size>
   //
   //
@@ -79,6 +79,20 @@
 // a program to execute. VM exits when the compilation is finished.
 //
 //
+// Batch replay.
+// -------------
+//
+// The replay data of every compilation can be appended to one archive,
+// from VM start with -XX:ReplayCaptureFile=replay_archive.log or at run
+// time with
+//
+// jcmd <pid> Compiler.replay_capture replay_archive.log
+// jcmd <pid> Compiler.replay_capture -stop
+//
+// The launcher in src/utils/ReplayCompiles replays all records of an
+// archive in parallel debug VMs. Each replay prints a ReplayResult line
+// with the compile time, arena bytes and code size of the compilation.
+//
 // Replay inlining.
 // ----------------
 //
@@ -34,6 +34,7 @@
 #include "classfile/moduleEntry.hpp"
 #include "classfile/symbolTable.hpp"
 #include "classfile/systemDictionary.hpp"
+#include "classfile/verificationCache.hpp"
 #include "classfile/verificationType.hpp"
 #include "classfile/verifier.hpp"
 #include "classfile/vmSymbols.hpp"
@@ -3881,7 +3882,6 @@ static unsigned int compute_oop_map_count(const InstanceKlass* super,
   return map_count;
 }
 
-#ifndef PRODUCT
 static void print_field_layout(const Symbol* name,
                                Array<u2>* fields,
                                const constantPoolHandle& cp,
@@ -3916,7 +3916,36 @@ static void print_field_layout(const Symbol* name,
   tty->print("  @%3d %s\n", static_fields_end, "--- static fields end ---");
   tty->print("\n");
 }
-#endif
+
+// Marks the bytes of the nonstatic fields of super and its superclasses.
+// Returns false if the layout has contended padding, which must stay empty.
+static bool mark_super_fields(const InstanceKlass* super, ResourceBitMap* occupied) {
+  for (const InstanceKlass* k = super; k != NULL; k = k->java_super()) {
+    if (k->is_contended()) {
+      return false;
+    }
+    for (AllFieldStream fs(const_cast<InstanceKlass*>(k)); !fs.done(); fs.next()) {
+      if (fs.access_flags().is_static()) continue;
+      if (fs.is_contended()) {
+        return false;
+      }
+      const BasicType type = FieldType::basic_type(fs.signature());
+      const int size = (type == T_OBJECT || type == T_ARRAY) ? heapOopSize : type2aelembytes(type);
+      occupied->set_range(fs.offset(), fs.offset() + size);
+    }
+  }
+  return true;
+}
+
+// Returns the first aligned offset in [start, end) with size free bytes, or -1.
+static int find_field_gap(const ResourceBitMap* occupied, int start, int end, int size) {
+  for (int offset = align_up(start, size); offset + size <= end; offset += size) {
+    if (occupied->get_next_one_offset(offset, offset + size) == (BitMap::idx_t)(offset + size)) {
+      return offset;
+    }
+  }
+  return -1;
+}
 
 // Values needed for oopmap and InstanceKlass creation
 class ClassFileParser::FieldLayoutInfo : public ResourceObj {
@@ -4095,6 +4124,35 @@ void ClassFileParser::layout_fields(ConstantPool* cp,
     ShouldNotReachHere();
   }
 
+  // Allocate primitive fields into the gaps left in the layout of the
+  // superclasses, largest first. Oops stay out of the gaps to keep the oop
+  // maps together, and so do contended fields and all fields of a contended
+  // class, which have to stay behind their padding.
+  if (CompactFieldsInSuperGaps && compact_fields && !is_contended_class &&
+      nonstatic_fields_start > instanceOopDesc::base_offset_in_bytes()) {
+    const int super_fields_start = instanceOopDesc::base_offset_in_bytes();
+    ResourceBitMap occupied(nonstatic_fields_start);
+    if (mark_super_fields(_super_klass, &occupied)) {
+      const FieldAllocationType types[] = { NONSTATIC_DOUBLE, NONSTATIC_WORD, NONSTATIC_SHORT, NONSTATIC_BYTE };
+      unsigned int* const counts[] = { &nonstatic_double_count, &nonstatic_word_count,
+                                       &nonstatic_short_count, &nonstatic_byte_count };
+      const int sizes[] = { BytesPerLong, BytesPerInt, BytesPerShort, 1 };
+      for (int i = 0; i < 4; i++) {
+        for (AllFieldStream fs(_fields, cp); *counts[i] > 0 && !fs.done(); fs.next()) {
+          if (fs.is_offset_set() || fs.is_contended() || fs.access_flags().is_static()) continue;
+          if ((FieldAllocationType) fs.allocation_type() != types[i]) continue;
+          const int offset = find_field_gap(&occupied, super_fields_start, nonstatic_fields_start, sizes[i]);
+          if (offset < 0) {
+            break;
+          }
+          occupied.set_range(offset, offset + sizes[i]);
+          fs.set_offset(offset);
+          *counts[i] -= 1;
+        }
+      }
+    }
+  }
+
   int nonstatic_oop_space_count   = 0;
   int nonstatic_word_space_count  = 0;
   int nonstatic_short_space_count = 0;
@@ -4427,7 +4485,6 @@ void ClassFileParser::layout_fields(ConstantPool* cp,
     compute_oop_map_count(_super_klass, nonstatic_oop_map_count,
                           first_nonstatic_oop_offset);
 
-#ifndef PRODUCT
   if (PrintFieldLayout) {
     print_field_layout(_class_name,
           _fields,
@@ -4438,7 +4495,6 @@ void ClassFileParser::layout_fields(ConstantPool* cp,
           static_fields_end);
   }
 
-#endif
   // Pass back information needed for InstanceKlass creation
   info->nonstatic_oop_offsets = nonstatic_oop_offsets;
   info->nonstatic_oop_counts = nonstatic_oop_counts;
@@ -5576,6 +5632,8 @@ InstanceKlass* ClassFileParser::create_instance_klass(bool changed_by_loadhook,
 
   assert(_klass == ik, "invariant");
 
+  VerificationCache::record_fingerprint(ik, _stream);
+
   ik->set_has_passed_fingerprint_check(false);
   if (UseAOT && ik->supers_have_passed_fingerprint_checks()) {
     uint64_t aot_fp = AOTLoader::get_saved_fingerprint(ik);
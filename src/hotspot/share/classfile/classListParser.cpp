@@ -25,15 +25,18 @@
 #include "precompiled.hpp"
 #include "jvm.h"
 #include "jimage.hpp"
+#include "classfile/classFileStream.hpp"
 #include "classfile/classListParser.hpp"
 #include "classfile/classLoaderExt.hpp"
 #include "classfile/symbolTable.hpp"
 #include "classfile/systemDictionary.hpp"
 #include "classfile/systemDictionaryShared.hpp"
+#include "gc/shared/workgroup.hpp"
 #include "logging/log.hpp"
 #include "logging/logTag.hpp"
 #include "memory/metaspaceShared.hpp"
 #include "memory/resourceArea.hpp"
+#include "runtime/atomic.hpp"
 #include "runtime/fieldType.hpp"
 #include "runtime/handles.inline.hpp"
 #include "runtime/javaCalls.hpp"
@@ -41,15 +44,192 @@
 #include "utilities/hashtable.inline.hpp"
 #include "utilities/macros.hpp"
 
+// Reads the class files of the "source:" lines of a class list from their jar
+// files ahead of the ClassListParser, a batch of lines at a time, with
+// ClassListPrefetchThreads workers. Reading and inflating the jar entries is
+// what the dumping thread otherwise spends most of its time on for custom
+// loader and EagerAppCDS classes. Parsing and defining the classes stays on
+// the dumping thread, in class list order.
+class ClassListPrefetcher : public CHeapObj<mtClass> {
+  friend class ClassListPrefetchTask;
+
+  struct Entry {
+    int                _line_no;
+    ClassPathZipEntry* _zip;
+    char*              _file_name;
+    u1*                _buffer;
+    jint               _size;
+  };
+
+  enum {
+    _batch_entries_per_thread = 64
+  };
+
+  static WorkGang* _workers;
+
+  ClassListParser       _reader;   // Lookahead parser of the same class list
+  GrowableArray<Entry>* _batch;
+  int                   _batch_size;
+  int                   _next;     // First entry of _batch that was not taken yet
+
+  void clear_batch();
+  void fill_batch(int line_no, TRAPS);
+  bool read_entry(TRAPS);
+
+ public:
+  ClassListPrefetcher(const char* file);
+  ~ClassListPrefetcher();
+
+  ClassFileStream* prefetched_stream(int line_no, ClassPathEntry* entry, const char* file_name, TRAPS);
+};
+
+class ClassListPrefetchTask : public AbstractGangTask {
+  GrowableArray<ClassListPrefetcher::Entry>* _batch;
+  volatile int _claimed;
+
+ public:
+  ClassListPrefetchTask(GrowableArray<ClassListPrefetcher::Entry>* batch) :
+    AbstractGangTask("Class List Prefetch"), _batch(batch), _claimed(0) {}
+
+  void work(uint worker_id) {
+    int i;
+    while ((i = Atomic::add(1, &_claimed) - 1) < _batch->length()) {
+      ClassListPrefetcher::Entry* e = _batch->adr_at(i);
+      e->_buffer = e->_zip->read_entry(e->_file_name, &e->_size);
+    }
+  }
+};
+
+WorkGang* ClassListPrefetcher::_workers = NULL;
+
+ClassListPrefetcher::ClassListPrefetcher(const char* file) :
+  _reader(file, /* lookahead */ true), _next(0) {
+  // ClassListPrefetchThreads is limited by its range, so this does not overflow.
+  _batch_size = _batch_entries_per_thread * (int)ClassListPrefetchThreads;
+  _batch = new (ResourceObj::C_HEAP, mtClass) GrowableArray<Entry>(_batch_size, true);
+  if (_workers == NULL) {
+    // Worker threads cannot be stopped, so the gang is kept for the next class list.
+    _workers = new WorkGang("Class List Prefetch", (uint)ClassListPrefetchThreads,
+                            /* are_GC_task_threads */ false,
+                            /* are_ConcurrentGC_threads */ false);
+    _workers->initialize_workers();
+  }
+}
+
+ClassListPrefetcher::~ClassListPrefetcher() {
+  clear_batch();
+  delete _batch;
+}
+
+void ClassListPrefetcher::clear_batch() {
+  for (int i = 0; i < _batch->length(); i++) {
+    Entry* e = _batch->adr_at(i);
+    os::free(e->_file_name);
+    if (e->_buffer != NULL) {
+      FREE_C_HEAP_ARRAY(u1, e->_buffer);
+    }
+  }
+  _batch->clear();
+  _next = 0;
+}
+
+// Adds an entry for the class file of the line _reader has just parsed if it
+// has a "source:" that is a jar file.
+bool ClassListPrefetcher::read_entry(TRAPS) {
+  if (!_reader.is_loading_from_source()) {
+    return false;
+  }
+
+  ResourceMark rm(THREAD);
+  ClassPathEntry* cpe = ClassLoaderExt::find_classpath_entry_from_cache(_reader._source, THREAD);
+  if (HAS_PENDING_EXCEPTION) {
+    CLEAR_PENDING_EXCEPTION;
+    return false;
+  }
+  if (cpe == NULL || !cpe->is_jar_file()) {
+    return false;
+  }
+  ClassPathZipEntry* zip = (ClassPathZipEntry*)cpe;
+  // Leave versioned entries to ClassPathZipEntry::open_stream().
+  bool versioned = zip->is_multiple_versioned(THREAD);
+  if (HAS_PENDING_EXCEPTION) {
+    CLEAR_PENDING_EXCEPTION;
+    return false;
+  }
+  if (versioned) {
+    return false;
+  }
+
+  const char* class_name = _reader.current_class_name();
+  Entry e;
+  e._line_no = _reader._line_no;
+  e._zip = zip;
+  e._file_name = os::strdup_check_oom(ClassLoader::file_name_for_class_name(class_name, (int)strlen(class_name)), mtClass);
+  e._buffer = NULL;
+  e._size = 0;
+  _batch->append(e);
+  return true;
+}
+
+// Reads the next batch of class files, starting at line_no of the class list.
+void ClassListPrefetcher::fill_batch(int line_no, TRAPS) {
+  clear_batch();
+  // _reader reports a malformed line the same way the parser would, only
+  // before the classes of the lines ahead of it are loaded.
+  while (_batch->length() < _batch_size && _reader.parse_one_line()) {
+    if (_reader._line_no >= line_no) {
+      read_entry(THREAD);
+    }
+  }
+  if (_batch->length() > 0) {
+    ClassListPrefetchTask task(_batch);
+    _workers->run_task(&task, _workers->total_workers());
+    log_debug(cds)("Prefetched %d class files up to line %d of the class list", _batch->length(), _reader._line_no);
+  }
+}
+
+ClassFileStream* ClassListPrefetcher::prefetched_stream(int line_no, ClassPathEntry* entry,
+                                                        const char* file_name, TRAPS) {
+  if (line_no > _reader._line_no) {
+    fill_batch(line_no, THREAD);
+  }
+  while (_next < _batch->length() && _batch->at(_next)._line_no < line_no) {
+    _next++;
+  }
+  if (_next == _batch->length()) {
+    return NULL;
+  }
+  Entry* e = _batch->adr_at(_next);
+  if (e->_line_no != line_no || e->_buffer == NULL || e->_zip != entry ||
+      strcmp(e->_file_name, file_name) != 0) {
+    return NULL;
+  }
+  _next++;
+
+  // Hand the bytes over in the resource area like ClassPathZipEntry::open_stream().
+  u1* buffer = NEW_RESOURCE_ARRAY_IN_THREAD(THREAD, u1, e->_size);
+  memcpy(buffer, e->_buffer, e->_size);
+  FREE_C_HEAP_ARRAY(u1, e->_buffer);
+  e->_buffer = NULL;
+  if (UsePerfData) {
+    ClassLoader::perf_sys_classfile_bytes_read()->inc(e->_size);
+  }
+  return new ClassFileStream(buffer, e->_size, e->_zip->name(), ClassFileStream::verify);
+}
+
 ClassListParser* ClassListParser::_instance = NULL;
 
-ClassListParser::ClassListParser(const char* file) {
-  assert(_instance == NULL, "must be singleton");
-  _instance = this;
+ClassListParser::ClassListParser(const char* file, bool lookahead) {
+  assert(lookahead || _instance == NULL, "must be singleton");
+  if (!lookahead) {
+    _instance = this;
+  }
+  _lookahead = lookahead;
   _classlist_file = file;
   _file = NULL;
   _line_no = 0;
   _interfaces = new (ResourceObj::C_HEAP, mtClass) GrowableArray<int>(10, true);
+  _prefetcher = NULL;
 
   _file = NULL;
   // Use os::open() because neither fopen() nor os::fopen()
@@ -66,13 +246,22 @@ ClassListParser::ClassListParser(const char* file) {
     os::lasterror(errmsg, JVM_MAXPATHLEN);
     vm_exit_during_initialization("Loading classlist failed", errmsg);
   }
+
+  if (ClassListPrefetchThreads > 0 && !lookahead) {
+    _prefetcher = new ClassListPrefetcher(file);
+  }
 }
 
 ClassListParser::~ClassListParser() {
   if (_file) {
     fclose(_file);
   }
-  _instance = NULL;
+  if (_prefetcher != NULL) {
+    delete _prefetcher;
+  }
+  if (!_lookahead) {
+    _instance = NULL;
+  }
 }
 
 bool ClassListParser::parse_one_line() {
@@ -484,6 +673,13 @@ Klass* ClassListParser::load_current_class(TRAPS) {
   return klass;
 }
 
+ClassFileStream* ClassListParser::prefetched_stream(ClassPathEntry* entry, const char* file_name, TRAPS) {
+  if (_prefetcher == NULL) {
+    return NULL;
+  }
+  return _prefetcher->prefetched_stream(_line_no, entry, file_name, THREAD);
+}
+
 bool ClassListParser::is_loading_from_source() {
   return (_source != NULL);
 }
@@ -30,12 +30,18 @@
 #include "utilities/growableArray.hpp"
 #include "utilities/hashtable.inline.hpp"
 
+class ClassFileStream;
+class ClassListPrefetcher;
+class ClassPathEntry;
+
 class ID2KlassTable : public KVHashtable<int, InstanceKlass*, mtInternal> {
 public:
   ID2KlassTable() : KVHashtable<int, InstanceKlass*, mtInternal>(1987) {}
 };
 
 class ClassListParser : public StackObj {
+  friend class ClassListPrefetcher;
+
   enum {
     _unspecified      = -999,
 
@@ -51,8 +57,10 @@ class ClassListParser : public StackObj {
   static ClassListParser* _instance; // the singleton.
   const char* _classlist_file;
   FILE* _file;
+  bool _lookahead;                   // Only reads the lines for the ClassListPrefetcher
 
   ID2KlassTable _id2klass_table;
+  ClassListPrefetcher* _prefetcher;  // NULL unless ClassListPrefetchThreads > 0
 
   // The following field contains information from the *current* line being
   // parsed.
@@ -83,7 +91,9 @@ class ClassListParser : public StackObj {
   void print_specified_interfaces();
   void print_actual_interfaces(InstanceKlass *ik);
 public:
-  ClassListParser(const char* file);
+  // A lookahead parser is not the singleton and does not check the ids
+  // of the supers and interfaces, which the dumping thread did not load yet.
+  ClassListParser(const char* file, bool lookahead = false);
   ~ClassListParser();
 
   static ClassListParser* instance() {
@@ -116,6 +126,9 @@ public:
     return _super;
   }
   bool check_already_loaded(const char* which, int id) {
+    if (_lookahead) {
+      return true;
+    }
     if (_id2klass_table.lookup(id) == NULL) {
       if (DumpAppCDSWithKlassId) {
         // In Classes4CDS flow, if the super class is not loaded, we don't error out.
@@ -135,6 +148,10 @@ public:
 
   Klass* load_current_class(TRAPS);
 
+  // The class file of the current line if it was prefetched from entry,
+  // NULL if it has to be opened.
+  ClassFileStream* prefetched_stream(ClassPathEntry* entry, const char* file_name, TRAPS);
+
   bool is_loading_from_source();
 
   // Look up the super or interface of the current class being loaded
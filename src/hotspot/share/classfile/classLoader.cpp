@@ -344,6 +344,30 @@ u1* ClassPathZipEntry::open_entry(const char* name, jint* filesize, bool nul_ter
 }
 
 #if INCLUDE_CDS
+// Like open_entry(), but reads into a C heap buffer the caller frees and does
+// not need a JavaThread, so that the class list can be prefetched by workers.
+u1* ClassPathZipEntry::read_entry(const char* name, jint* filesize) {
+  jint name_len;
+  jzentry* entry = (*FindEntry)(_zip, name, filesize, &name_len);
+  if (entry == NULL) return NULL;
+  char name_buf[128];
+  char* filename = name_buf;
+  if (name_len >= 128) {
+    filename = NEW_C_HEAP_ARRAY(char, name_len + 1, mtClass);
+  }
+
+  u1* buffer = NEW_C_HEAP_ARRAY(u1, (uint32_t)(*filesize), mtClass);
+  bool read = (*ReadEntry)(_zip, entry, buffer, filename);
+  if (filename != name_buf) {
+    FREE_C_HEAP_ARRAY(char, filename);
+  }
+  if (!read) {
+    FREE_C_HEAP_ARRAY(u1, buffer);
+    return NULL;
+  }
+  return buffer;
+}
+
 u1* ClassPathZipEntry::open_versioned_entry(const char* name, jint* filesize, TRAPS) {
   u1* buffer = NULL;
   if (!_is_boot_append) {
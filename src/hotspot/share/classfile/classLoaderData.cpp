@@ -56,6 +56,8 @@
 #include "classfile/packageEntry.hpp"
 #include "classfile/symbolTable.hpp"
 #include "classfile/systemDictionary.hpp"
+#include "gc/shared/gcTraceTime.inline.hpp"
+#include "gc/shared/workgroup.hpp"
 #include "logging/log.hpp"
 #include "logging/logStream.hpp"
 #include "memory/allocation.inline.hpp"
@@ -1427,29 +1429,6 @@ bool ClassLoaderDataGraph::do_unloading(bool clean_previous_versions) {
   }
 
   if (seen_dead_loader) {
-    data = _head;
-    while (data != NULL) {
-      // Walk a ModuleEntry's reads, and a PackageEntry's exports
-      // lists to determine if there are modules on those lists that are now
-      // dead and should be removed.  A module's life cycle is equivalent
-      // to its defining class loader's life cycle.  Since a module is
-      // considered dead if its class loader is dead, these walks must
-      // occur after each class loader's aliveness is determined.
-      if (data->packages() != NULL) {
-        data->packages()->purge_all_package_exports();
-      }
-      if (data->modules_defined()) {
-        data->modules()->purge_all_module_reads();
-      }
-      // Clean cached pd lists
-      // It's unlikely, but some loaded classes in a dictionary might
-      // point to a protection_domain that has been unloaded.
-      // The dictionary pd_set points at entries in the ProtectionDomainCacheTable.
-      if (data->dictionary() != NULL) {
-        data->dictionary()->clean_cached_protection_domains();
-      }
-      data = data->next();
-    }
     JFR_ONLY(post_class_unload_events();)
   }
 
@@ -1458,19 +1437,87 @@ bool ClassLoaderDataGraph::do_unloading(bool clean_previous_versions) {
   return seen_dead_loader;
 }
 
+// Walk a ModuleEntry's reads, and a PackageEntry's exports lists to determine
+// if there are modules on those lists that are now dead and should be removed.
+// A module's life cycle is equivalent to its defining class loader's life
+// cycle.  Since a module is considered dead if its class loader is dead, these
+// walks must occur after each class loader's aliveness is determined.
+static void clean_cld_module_and_package_info(ClassLoaderData* data) {
+  if (data->packages() != NULL) {
+    data->packages()->purge_all_package_exports();
+  }
+  if (data->modules_defined()) {
+    data->modules()->purge_all_module_reads();
+  }
+  // Clean cached pd lists
+  // It's unlikely, but some loaded classes in a dictionary might
+  // point to a protection_domain that has been unloaded.
+  // The dictionary pd_set points at entries in the ProtectionDomainCacheTable.
+  if (data->dictionary() != NULL) {
+    data->dictionary()->clean_cached_protection_domains();
+  }
+}
+
+// Each class loader only updates its own tables, so the GC workers can
+// claim them one by one.
+class CLDCleaningTask : public AbstractGangTask {
+  ClassLoaderData* volatile _next;
+
+  ClassLoaderData* claim_next() {
+    ClassLoaderData* data = _next;
+    while (data != NULL) {
+      ClassLoaderData* prev = Atomic::cmpxchg(data->next(), &_next, data);
+      if (prev == data) {
+        return data;
+      }
+      data = prev;
+    }
+    return NULL;
+  }
+
+ public:
+  CLDCleaningTask(ClassLoaderData* head) : AbstractGangTask("CLD Cleaning"), _next(head) {}
+
+  void work(uint worker_id) {
+    ClassLoaderData* data;
+    while ((data = claim_next()) != NULL) {
+      clean_cld_module_and_package_info(data);
+    }
+  }
+};
+
+void ClassLoaderDataGraph::clean_module_and_package_info(WorkGang* workers) {
+  assert(SafepointSynchronize::is_at_safepoint(), "must be at safepoint!");
+  if (workers != NULL && workers->active_workers() > 1) {
+    CLDCleaningTask task(_head);
+    workers->run_task(&task);
+  } else {
+    for (ClassLoaderData* data = _head; data != NULL; data = data->next()) {
+      clean_cld_module_and_package_info(data);
+    }
+  }
+}
+
 void ClassLoaderDataGraph::purge() {
   assert(SafepointSynchronize::is_at_safepoint(), "must be at safepoint!");
   ClassLoaderData* list = _unloading;
   _unloading = NULL;
   ClassLoaderData* next = list;
   bool classes_unloaded = false;
-  while (next != NULL) {
-    ClassLoaderData* purge_me = next;
-    next = purge_me->next();
-    delete purge_me;
-    classes_unloaded = true;
+  uint loaders_deleted = 0;
+  {
+    GCTraceTime(Debug, gc, phases) t("Purge ClassLoaderData");
+    while (next != NULL) {
+      ClassLoaderData* purge_me = next;
+      next = purge_me->next();
+      delete purge_me;
+      classes_unloaded = true;
+      loaders_deleted++;
+    }
   }
+  log_debug(class, loader, data)("purge: loaders deleted %u", loaders_deleted);
   if (classes_unloaded) {
+    GCTraceTime(Debug, gc, phases) t("Purge Metaspace");
     Metaspace::purge();
     set_metaspace_oom(false);
   }
@@ -62,6 +62,7 @@ class ModuleEntryTable;
 class PackageEntryTable;
 class DictionaryEntry;
 class Dictionary;
+class WorkGang;
 
 // GC root for walking class loader data created
 
@@ -117,6 +118,9 @@ class ClassLoaderDataGraph : public AllStatic {
   static void loaded_classes_do(KlassClosure* klass_closure);
   static void classes_unloading_do(void f(Klass* const));
   static bool do_unloading(bool clean_previous_versions);
+  // Removes references to unloaded modules and protection domains from the
+  // live class loaders, in parallel when workers are given.
+  static void clean_module_and_package_info(WorkGang* workers = NULL);
 
   // dictionary do
   // Iterate over all klasses in dictionary, but
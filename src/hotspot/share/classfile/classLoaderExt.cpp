@@ -281,7 +281,13 @@ InstanceKlass* ClassLoaderExt::load_class(Symbol* name, const char* path, const
     PerfClassTraceTime vmtimer(perf_sys_class_lookup_time(),
                                ((JavaThread*) THREAD)->get_thread_stat()->perf_timers_addr(),
                                PerfClassTraceTime::CLASS_LOAD);
-    stream = e->open_stream(file_name, CHECK_NULL);
+    ClassListParser* parser = ClassListParser::instance();
+    if (parser != NULL) {
+      stream = parser->prefetched_stream(e, file_name, CHECK_NULL);
+    }
+    if (stream == NULL) {
+      stream = e->open_stream(file_name, CHECK_NULL);
+    }
   }
 
   if (NULL == stream) {
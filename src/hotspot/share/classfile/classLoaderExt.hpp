@@ -30,8 +30,11 @@
 #include "utilities/macros.hpp"
 
 class ClassListParser;
+class ClassListPrefetcher;
 
 class ClassLoaderExt: public ClassLoader { // AllStatic
+  friend class ClassListPrefetcher;
+
 public:
   enum SomeConstants {
     max_classpath_index = 0x7fff
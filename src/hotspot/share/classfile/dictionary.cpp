@@ -104,8 +104,11 @@ void Dictionary::free_entry(DictionaryEntry* entry) {
 
 const int _resize_load_trigger = 5;       // load factor that will trigger the resize
 const double _resize_factor    = 2.0;     // by how much we will resize using current number of entries
-const int _resize_max_size     = 40423;   // the max dictionary size allowed
-const int _primelist[] = {107, 1009, 2017, 4049, 5051, 10103, 20201, _resize_max_size};
+const int _resize_max_size     = 1280023; // the max dictionary size allowed
+// Loaders of generated classes (proxies, lambda forms, scripting engines)
+// can define hundreds of thousands of classes, keep their chains short too.
+const int _primelist[] = {107, 1009, 2017, 4049, 5051, 10103, 20201, 40423,
+                          80021, 160001, 320009, 640007, _resize_max_size};
 const int _prime_array_size = sizeof(_primelist)/sizeof(int);
 
 // Calculate next "good" dictionary size based on requested count
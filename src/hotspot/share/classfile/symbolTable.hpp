@@ -26,7 +26,9 @@
 #define SHARE_VM_CLASSFILE_SYMBOLTABLE_HPP
 
 #include "memory/allocation.hpp"
+#include "memory/padded.hpp"
 #include "oops/symbol.hpp"
+#include "utilities/concurrentHashTable.hpp"
 #include "utilities/hashtable.hpp"
 
 // The symbol table holds all Symbol*s and corresponding interned strings.
@@ -34,10 +36,10 @@
 //
 // The interned strings are created lazily.
 //
-// It is implemented as an open hash table with a fixed number of buckets.
-//
-// %note:
-//  - symbolTableEntrys are allocated in blocks to reduce the space overhead.
+// It is implemented as a ConcurrentHashTable: lookups are lock-free and
+// inserts are a CAS on the bucket. Symbols whose reference count dropped
+// to zero are dead; the ServiceThread unlinks and frees them, and grows
+// the table, concurrently with Java execution.
 
 class BoolObjectClosure;
 class outputStream;
@@ -98,34 +100,69 @@ class TempNewSymbol : public StackObj {
 
 template <class T, class N> class CompactHashtable;
 
-class SymbolTable : public RehashableHashtable<Symbol*, mtSymbol> {
+class SymbolTable;
+class SymbolTableConfig;
+typedef ConcurrentHashTable<Symbol*,
+                            SymbolTableConfig, mtSymbol> SymbolTableHash;
+
+class SymbolTableCreateEntry;
+
+class SymbolTable : public CHeapObj<mtSymbol> {
   friend class VMStructs;
+  friend class Symbol;
   friend class ClassFileParser;
+  friend class SymbolTableConfig;
+  friend class SymbolTableCreateEntry;
 
 private:
+  static void delete_symbol(Symbol* sym);
+  void grow(JavaThread* jt);
+  void clean_dead_entries(JavaThread* jt);
+
   // The symbol table
   static SymbolTable* _the_table;
-
-  // Set if one bucket is out of balance due to hash algorithm deficiency
-  static bool _needs_rehashing;
+  // Shared symbol table.
+  static CompactHashtable<Symbol*, char> _shared_table;
   static bool _lookup_shared_first;
+  static bool _alt_hash;
 
   // For statistics
-  static int _symbols_removed;
-  static int _symbols_counted;
+  volatile size_t _symbols_removed;
+  volatile size_t _symbols_counted;
 
-  // shared symbol table.
-  static CompactHashtable<Symbol*, char> _shared_table;
+  SymbolTableHash* _local_table;
+  size_t _current_size;
+  volatile bool _has_work;
+  // Set if one bucket is out of balance due to hash algorithm deficiency
+  volatile bool _needs_rehashing;
+
+  volatile size_t _items_count;
+  DEFINE_PAD_MINUS_SIZE(1, DEFAULT_CACHE_LINE_SIZE, sizeof(volatile size_t));
+  volatile size_t _uncleaned_items_count;
+  DEFINE_PAD_MINUS_SIZE(2, DEFAULT_CACHE_LINE_SIZE, sizeof(volatile size_t));
+
+  double get_load_factor();
+  double get_dead_factor();
+
+  void check_concurrent_work();
+  void trigger_concurrent_work();
 
-  Symbol* allocate_symbol(const u1* name, int len, bool c_heap, TRAPS); // Assumes no characters larger than 0x7F
+  static void item_added();
+  static void item_removed(bool dead);
+  // Called by Symbol when its reference count drops to zero.
+  static void item_dead();
+
+  SymbolTable();
+
+  Symbol* allocate_symbol(const u1* name, int len, bool c_heap); // Assumes no characters larger than 0x7F
+  Symbol* do_lookup(const char* name, int len, uintx hash);
+  Symbol* do_add_if_needed(const char* name, int len, uintx hash, bool c_heap, TRAPS);
 
   // Adding elements
-  Symbol* basic_add(int index, u1* name, int len, unsigned int hashValue,
-                    bool c_heap, TRAPS);
-  bool basic_add(ClassLoaderData* loader_data,
-                 const constantPoolHandle& cp, int names_count,
-                 const char** names, int* lengths, int* cp_indices,
-                 unsigned int* hashValues, TRAPS);
+  static void add(ClassLoaderData* loader_data,
+                  const constantPoolHandle& cp, int names_count,
+                  const char** names, int* lengths, int* cp_indices,
+                  unsigned int* hashValues, TRAPS);
 
   static void new_symbols(ClassLoaderData* loader_data,
                           const constantPoolHandle& cp, int names_count,
@@ -136,15 +173,8 @@ private:
   }
 
   static Symbol* lookup_shared(const char* name, int len, unsigned int hash);
-  Symbol* lookup_dynamic(int index, const char* name, int len, unsigned int hash);
-  Symbol* lookup(int index, const char* name, int len, unsigned int hash);
-
-  SymbolTable()
-    : RehashableHashtable<Symbol*, mtSymbol>(SymbolTableSize, sizeof (HashtableEntry<Symbol*, mtSymbol>)) {}
-
-  SymbolTable(HashtableBucket<mtSymbol>* t, int number_of_entries)
-    : RehashableHashtable<Symbol*, mtSymbol>(SymbolTableSize, sizeof (HashtableEntry<Symbol*, mtSymbol>), t,
-                number_of_entries) {}
+  Symbol* lookup_dynamic(const char* name, int len, unsigned int hash);
+  Symbol* lookup_common(const char* name, int len, unsigned int hash);
 
   // Arena for permanent symbols (null class loader) that are never unloaded
   static Arena*  _arena;
@@ -152,13 +182,13 @@ private:
 
   static void initialize_symbols(int arena_alloc_size = 0);
 
-  static volatile int _parallel_claimed_idx;
+  void concurrent_work(JavaThread* jt);
+  void print_table_statistics(outputStream* st, const char* table_name);
+  static void print_latency_statistics(outputStream* st);
+
+  void try_rehash_table();
+  bool do_rehash();
 
-  typedef SymbolTable::BucketUnlinkContext BucketUnlinkContext;
-  // Release any dead symbols. Unlinked bucket entries are collected in the given
-  // context to be freed later.
-  // This allows multiple threads to work on the table at once.
-  static void buckets_unlink(int start_idx, int end_idx, BucketUnlinkContext* context);
 public:
   enum {
     symbol_alloc_batch_size = 8,
@@ -168,9 +198,7 @@ public:
 
   // The symbol table
   static SymbolTable* the_table() { return _the_table; }
-
-  // Size of one bucket in the string table.  Used when checking for rollover.
-  static uint bucket_size() { return sizeof(HashtableBucket<mtSymbol>); }
+  size_t table_size(Thread* thread = NULL);
 
   static void create_table() {
     assert(_the_table == NULL, "One symbol table allowed.");
@@ -178,6 +206,9 @@ public:
     initialize_symbols(symbol_alloc_arena_size);
   }
 
+  static void do_concurrent_work(JavaThread* jt);
+  static bool has_work() { return the_table()->_has_work; }
+
   static unsigned int hash_symbol(const char* s, int len);
   static unsigned int hash_shared_symbol(const char* s, int len);
 
@@ -187,29 +218,16 @@ public:
   // Only copy to C string to be added if lookup failed.
   static Symbol* lookup(const Symbol* sym, int begin, int end, TRAPS);
 
-  static void release(Symbol* sym);
-
-  // Look up the address of the literal in the SymbolTable for this Symbol*
-  static Symbol** lookup_symbol_addr(Symbol* sym);
-
   // jchar (UTF16) version of lookups
   static Symbol* lookup_unicode(const jchar* name, int len, TRAPS);
   static Symbol* lookup_only_unicode(const jchar* name, int len, unsigned int& hash);
 
-  static void add(ClassLoaderData* loader_data,
-                  const constantPoolHandle& cp, int names_count,
-                  const char** names, int* lengths, int* cp_indices,
-                  unsigned int* hashValues, TRAPS);
-
-  // Release any dead symbols
+  // Dead symbols are removed concurrently by the ServiceThread. The GC only
+  // checks, when it is done with class unloading, whether enough symbols
+  // died to start that work.
   static void unlink() {
-    int processed = 0;
-    int removed = 0;
-    unlink(&processed, &removed);
+    the_table()->check_concurrent_work();
   }
-  static void unlink(int* processed, int* removed);
-  // Release any dead symbols, possibly parallel version
-  static void possibly_parallel_unlink(int* processed, int* removed);
 
   // iterate over symbols
   static void symbols_do(SymbolClosure *cl);
@@ -231,9 +249,6 @@ public:
   // Create a symbol in the arena for symbols that are not deleted
   static Symbol* new_permanent_symbol(const char* name, TRAPS);
 
-  // Symbol lookup
-  static Symbol* lookup(int index, const char* name, int len, TRAPS);
-
   // Needed for preloading classes in signatures when compiling.
   // Returns the symbol is already present in symbol table, otherwise
   // NULL.  NO ALLOCATION IS GUARANTEED!
@@ -248,7 +263,6 @@ public:
 
   // Histogram
   static void print_histogram()     PRODUCT_RETURN;
-  static void print()     PRODUCT_RETURN;
 
   // Debugging
   static void verify();
@@ -263,10 +277,8 @@ public:
 
   // Rehash the symbol table if it gets out of balance
   static void rehash_table();
-  static bool needs_rehashing()         { return _needs_rehashing; }
-  // Parallel chunked scanning
-  static void clear_parallel_claimed_index() { _parallel_claimed_idx = 0; }
-  static int parallel_claimed_index()        { return _parallel_claimed_idx; }
+  static bool needs_rehashing()
+    { return SymbolTable::the_table()->_needs_rehashing; }
 };
 
 #endif // SHARE_VM_CLASSFILE_SYMBOLTABLE_HPP
@@ -1989,7 +1989,8 @@ void SystemDictionary::add_to_hierarchy(InstanceKlass* k, TRAPS) {
 // Assumes classes in the SystemDictionary are only unloaded at a safepoint
 // Note: anonymous classes are not in the SD.
 bool SystemDictionary::do_unloading(GCTimer* gc_timer,
-                                    bool do_cleaning) {
+                                    bool do_cleaning,
+                                    WorkGang* workers) {
 
   bool unloading_occurred;
   {
@@ -1999,6 +2000,11 @@ bool SystemDictionary::do_unloading(GCTimer* gc_timer,
     unloading_occurred = ClassLoaderDataGraph::do_unloading(do_cleaning);
   }
 
+  if (unloading_occurred) {
+    GCTraceTime(Debug, gc, phases) t("Module and Package Info", gc_timer);
+    ClassLoaderDataGraph::clean_module_and_package_info(workers);
+  }
+
   if (unloading_occurred) {
     GCTraceTime(Debug, gc, phases) t("Dictionary", gc_timer);
     constraints()->purge_loader_constraints();
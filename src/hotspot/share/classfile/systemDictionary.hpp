@@ -88,6 +88,7 @@ class ProtectionDomainCacheTable;
 class ProtectionDomainCacheEntry;
 class GCTimer;
 class OopStorage;
+class WorkGang;
 
 #define WK_KLASS_ENUM_NAME(kname)    kname##_knum
 
@@ -397,7 +398,8 @@ public:
   // Unload (that is, break root links to) all unmarked classes and
   // loaders.  Returns "true" iff something was unloaded.
   static bool do_unloading(GCTimer* gc_timer,
-                           bool do_cleaning = true);
+                           bool do_cleaning = true,
+                           WorkGang* workers = NULL);
 
   // Used by DumpSharedSpaces only to remove classes that failed verification
   static void remove_classes_in_error_state();
@@ -0,0 +1,514 @@
+/*
+ * Copyright (c) 2026, Alibaba Group Holding Limited. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+#include "precompiled.hpp"
+#include "jvm.h"
+#include "classfile/classFileStream.hpp"
+#include "classfile/classLoader.hpp"
+#include "classfile/symbolTable.hpp"
+#include "classfile/systemDictionary.hpp"
+#include "classfile/verificationCache.hpp"
+#include "classfile/verificationType.hpp"
+#include "classfile/verifier.hpp"
+#include "logging/log.hpp"
+#include "memory/resourceArea.hpp"
+#include "oops/instanceKlass.hpp"
+#include "oops/symbol.hpp"
+#include "runtime/globals_extension.hpp"
+#include "runtime/mutexLocker.hpp"
+#include "runtime/os.hpp"
+#include "runtime/quickStart.hpp"
+#include "runtime/vm_version.hpp"
+#include "utilities/resourceHash.hpp"
+#include "utilities/sha256.hpp"
+
+#define VERIFICATION_CACHE_FILE     "verification.cache"
+#define VERIFICATION_CACHE_HEADER   "# verification cache, version 3"
+
+// Names longer than this are not written, which bounds the line length.
+static const int max_name_length = 1024;
+
+// The SHA-256 digest of a class file. A weaker checksum would let a class
+// with the bytes of a verified class's length and checksum skip verification.
+class VerificationCache::Fingerprint {
+ public:
+  u1 _bytes[SHA256::digest_length];
+
+  static unsigned hash(const Fingerprint& fp) {
+    // The digest is uniformly distributed already.
+    return (unsigned)fp._bytes[0] | ((unsigned)fp._bytes[1] << 8) |
+           ((unsigned)fp._bytes[2] << 16) | ((unsigned)fp._bytes[3] << 24);
+  }
+  static bool equals(const Fingerprint& a, const Fingerprint& b) {
+    return memcmp(a._bytes, b._bytes, sizeof(a._bytes)) == 0;
+  }
+
+  void print_on(FILE* file) const {
+    for (int i = 0; i < SHA256::digest_length; i++) {
+      fprintf(file, "%02x", _bytes[i]);
+    }
+  }
+  // Parses the hex digits written by print_on().
+  bool parse(const char* hex) {
+    if (strlen(hex) != 2 * SHA256::digest_length) {
+      return false;
+    }
+    for (int i = 0; i < SHA256::digest_length; i++) {
+      unsigned int b;
+      if (sscanf(hex + 2 * i, "%2x", &b) != 1) {
+        return false;
+      }
+      _bytes[i] = (u1)b;
+    }
+    return true;
+  }
+};
+
+// Long enough for the hex digits of a Fingerprint and the terminating NUL.
+static const int fingerprint_chars = 2 * SHA256::digest_length + 1;
+
+class VerificationCache::Record : public CHeapObj<mtClass> {
+ public:
+  Symbol*      _name;
+  Fingerprint  _fingerprint;
+  int          _super_count;
+  Fingerprint* _super_fingerprints;  // Nearest superclass first
+  int          _constraint_count;
+  Constraint*  _constraints;
+  Record*      _next;                // In _loaded_records or _new_records
+
+  Record(Symbol* name, const Fingerprint& fingerprint, int super_count, int constraint_count) :
+    _name(name), _fingerprint(fingerprint),
+    _super_count(super_count),
+    _super_fingerprints(NEW_C_HEAP_ARRAY(Fingerprint, super_count, mtClass)),
+    _constraint_count(constraint_count),
+    _constraints(NEW_C_HEAP_ARRAY(Constraint, constraint_count, mtClass)),
+    _next(NULL) {}
+
+  ~Record() {
+    FREE_C_HEAP_ARRAY(Fingerprint, _super_fingerprints);
+    FREE_C_HEAP_ARRAY(Constraint, _constraints);
+  }
+};
+
+// The records read from the file by fingerprint, not changed after initialize().
+typedef ResourceHashtable<VerificationCache::Fingerprint, VerificationCache::Record*,
+                          VerificationCache::Fingerprint::hash, VerificationCache::Fingerprint::equals,
+                          8191, ResourceObj::C_HEAP, mtClass> RecordTable;
+// The fingerprints of the class files of loaded classes, under VerificationCache_lock.
+typedef ResourceHashtable<InstanceKlass*, VerificationCache::Fingerprint,
+                          primitive_hash<InstanceKlass*>, primitive_equals<InstanceKlass*>,
+                          8191, ResourceObj::C_HEAP, mtClass> FingerprintTable;
+
+static RecordTable*      _records      = NULL;
+static FingerprintTable* _fingerprints = NULL;
+
+const char*                 VerificationCache::_path           = NULL;
+VerificationCache::Record*  VerificationCache::_loaded_records = NULL;
+VerificationCache::Record*  VerificationCache::_new_records    = NULL;
+
+VerificationCache::Constraint::Constraint(Symbol* name, Symbol* from_name, bool from_field_is_protected,
+                                          bool from_is_array, bool from_is_object, bool assignable) :
+  _name(name), _from_name(from_name), _signature(NULL),
+  _flags((from_field_is_protected ? _from_field_is_protected : 0) |
+         (from_is_array           ? _from_is_array           : 0) |
+         (from_is_object          ? _from_is_object          : 0) |
+         (assignable              ? _assignable              : 0)) {}
+
+VerificationCache::Constraint VerificationCache::Constraint::protected_access(Symbol* klass_name,
+    Symbol* member_name, Symbol* member_sig, bool is_method, bool is_protected_access) {
+  Constraint c;
+  c._name = klass_name;
+  c._from_name = member_name;
+  c._signature = member_sig;
+  c._flags = _protected_access_check |
+             (is_method           ? _is_method           : 0) |
+             (is_protected_access ? _is_protected_access : 0);
+  return c;
+}
+
+const char* VerificationCache::default_path() {
+  if (!QuickStart::is_enabled() || QuickStart::cache_path() == NULL) {
+    return NULL;
+  }
+  size_t len = strlen(QuickStart::cache_path()) + strlen(os::file_separator()) +
+               strlen(VERIFICATION_CACHE_FILE) + 1;
+  char* path = NEW_C_HEAP_ARRAY(char, len, mtClass);
+  jio_snprintf(path, len, "%s%s%s", QuickStart::cache_path(), os::file_separator(), VERIFICATION_CACHE_FILE);
+  return path;
+}
+
+void VerificationCache::initialize(TRAPS) {
+  assert(UseVerificationCache, "sanity");
+  if (DumpSharedSpaces) {
+    // Archived classes are not verified at runtime anyway.
+    FLAG_SET_DEFAULT(UseVerificationCache, false);
+    return;
+  }
+  _path = (VerificationCacheFile != NULL) ? VerificationCacheFile : default_path();
+  if (_path == NULL) {
+    warning("Disabling UseVerificationCache: it needs VerificationCacheFile or QuickStart");
+    FLAG_SET_DEFAULT(UseVerificationCache, false);
+    return;
+  }
+  _records = new (ResourceObj::C_HEAP, mtClass) RecordTable();
+  _fingerprints = new (ResourceObj::C_HEAP, mtClass) FingerprintTable();
+  load(THREAD);
+}
+
+static bool read_line(FILE* file, char* line, int len) {
+  if (fgets(line, len, file) == NULL) {
+    return false;
+  }
+  size_t n = strlen(line);
+  if (n > 0 && line[n - 1] == '\n') {
+    line[n - 1] = '\0';
+  }
+  return true;
+}
+
+void VerificationCache::load(TRAPS) {
+  int fd = os::open(_path, O_RDONLY, S_IREAD);
+  FILE* file = (fd != -1) ? os::open(fd, "r") : NULL;
+  if (file == NULL) {
+    log_info(verification)("Verification cache %s not found", _path);
+    return;
+  }
+
+  char line[4 * max_name_length];
+  char name[max_name_length];
+  char from_name[max_name_length];
+  char signature[max_name_length];
+  char hex[fingerprint_chars];
+  const char* vm = VM_Version::internal_vm_info_string();
+  if (!read_line(file, line, sizeof(line)) || strcmp(line, VERIFICATION_CACHE_HEADER) != 0 ||
+      !read_line(file, line, sizeof(line)) || strncmp(line, "vm ", 3) != 0 || strcmp(line + 3, vm) != 0) {
+    log_info(verification)("Verification cache %s is for another VM, ignoring it", _path);
+    fclose(file);
+    return;
+  }
+
+  int count = 0;
+  bool valid = true;
+  while (valid && read_line(file, line, sizeof(line))) {
+    Fingerprint fingerprint;
+    int super_count;
+    int constraint_count;
+    if (sscanf(line, "class %1023s %64s %d %d", name, hex, &super_count, &constraint_count) != 4 ||
+        !fingerprint.parse(hex) || super_count < 0 || constraint_count < 0) {
+      valid = false;
+      break;
+    }
+    Record* r = new Record(SymbolTable::new_permanent_symbol(name, CHECK),
+                           fingerprint, super_count, constraint_count);
+    for (int i = 0; valid && i < super_count; i++) {
+      valid = read_line(file, line, sizeof(line)) &&
+              sscanf(line, " %64s", hex) == 1 && r->_super_fingerprints[i].parse(hex);
+    }
+    for (int i = 0; valid && i < constraint_count; i++) {
+      int flags;
+      int n = read_line(file, line, sizeof(line)) ?
+              sscanf(line, " %1023s %1023s %d %1023s", name, from_name, &flags, signature) : 0;
+      valid = (n == 3 && (flags & Constraint::_protected_access_check) == 0) ||
+              (n == 4 && (flags & Constraint::_protected_access_check) != 0);
+      if (valid) {
+        Constraint* c = &r->_constraints[i];
+        c->_name = SymbolTable::new_permanent_symbol(name, CHECK);
+        c->_from_name = SymbolTable::new_permanent_symbol(from_name, CHECK);
+        if (n == 4) {
+          c->_signature = SymbolTable::new_permanent_symbol(signature, CHECK);
+        }
+        c->_flags = (u1)flags;
+      }
+    }
+    if (!valid) {
+      delete r;
+    } else if (_records->get(fingerprint) != NULL) {
+      // Only written by a broken VM, keep the first record like the file
+      // rewritten by write() does.
+      delete r;
+    } else {
+      _records->put(fingerprint, r);
+      r->_next = _loaded_records;
+      _loaded_records = r;
+      count++;
+    }
+  }
+  fclose(file);
+
+  if (!valid) {
+    log_info(verification)("Verification cache %s is corrupt after %d classes", _path, count);
+  }
+  log_info(verification)("Loaded %d classes from verification cache %s", count, _path);
+}
+
+void VerificationCache::record_fingerprint(InstanceKlass* ik, const ClassFileStream* stream) {
+  if (!UseVerificationCache) {
+    return;
+  }
+  if (ik->class_loader() == NULL && stream->source() != NULL &&
+      ClassLoader::is_modules_image(stream->source())) {
+    // Classes of the runtime image cannot change without the VM changing.
+    // Those of -Xbootclasspath/a can, and may be superclasses of verified
+    // classes.
+    return;
+  }
+  Fingerprint fingerprint;
+  SHA256::digest(stream->buffer(), stream->length(), fingerprint._bytes);
+  MutexLockerEx ml(VerificationCache_lock, Mutex::_no_safepoint_check_flag);
+  _fingerprints->put(ik, fingerprint);
+}
+
+void VerificationCache::klass_unloading(InstanceKlass* ik) {
+  if (!UseVerificationCache) {
+    return;
+  }
+  MutexLockerEx ml(VerificationCache_lock, Mutex::_no_safepoint_check_flag);
+  _fingerprints->remove(ik);
+}
+
+// False if no fingerprint of ik was recorded.
+bool VerificationCache::fingerprint(InstanceKlass* ik, Fingerprint* fp) {
+  MutexLockerEx ml(VerificationCache_lock, Mutex::_no_safepoint_check_flag);
+  Fingerprint* fingerprint = _fingerprints->get(ik);
+  if (fingerprint == NULL) {
+    return false;
+  }
+  *fp = *fingerprint;
+  return true;
+}
+
+VerificationCache::Record* VerificationCache::lookup(InstanceKlass* ik) {
+  Fingerprint fp;
+  if (!fingerprint(ik, &fp)) {
+    return NULL;
+  }
+  // The table compares the whole digest.
+  Record** r = _records->get(fp);
+  return (r != NULL && (*r)->_name == ik->name()) ? *r : NULL;
+}
+
+// The superclass of ik whose fingerprint is recorded, or NULL if the
+// remaining superclasses are boot loader classes without a fingerprint. They
+// are from the runtime image or the CDS archive, which cannot change without
+// the VM or the archive failing to map.
+InstanceKlass* VerificationCache::next_fingerprinted_super(InstanceKlass* ik) {
+  InstanceKlass* super = ik->java_super();
+  Fingerprint fp;
+  if (super == NULL || (super->class_loader() == NULL && !fingerprint(super, &fp))) {
+    return NULL;
+  }
+  return super;
+}
+
+bool VerificationCache::supers_match(InstanceKlass* ik, Record* r) {
+  int i = 0;
+  for (InstanceKlass* super = next_fingerprinted_super(ik);
+       super != NULL;
+       super = next_fingerprinted_super(super), i++) {
+    Fingerprint fp;
+    if (i == r->_super_count || !fingerprint(super, &fp) ||
+        !Fingerprint::equals(r->_super_fingerprints[i], fp)) {
+      return false;
+    }
+  }
+  return i == r->_super_count;
+}
+
+bool VerificationCache::is_verified(InstanceKlass* ik, TRAPS) {
+  Record* r = lookup(ik);
+  if (r == NULL || !supers_match(ik, r)) {
+    return false;
+  }
+  for (int i = 0; i < r->_constraint_count; i++) {
+    bool matches = check_constraint(ik, &r->_constraints[i], CHECK_false);
+    if (!matches) {
+      return false;
+    }
+  }
+  return true;
+}
+
+bool VerificationCache::check_constraint(InstanceKlass* ik, Constraint* c, TRAPS) {
+  if ((c->_flags & Constraint::_protected_access_check) != 0) {
+    Klass* target = SystemDictionary::resolve_or_fail(c->_name,
+        Handle(THREAD, ik->class_loader()), Handle(THREAD, ik->protection_domain()), true, CHECK_false);
+    bool is_protected = ClassVerifier::check_protected_access(ik, target, c->_from_name, c->_signature,
+                                                              (c->_flags & Constraint::_is_method) != 0);
+    if (is_protected != ((c->_flags & Constraint::_is_protected_access) != 0)) {
+      if (log_is_enabled(Debug, verification)) {
+        ResourceMark rm(THREAD);
+        log_debug(verification)("Verification cache: access to %s.%s%s is %sprotected for %s now",
+                                c->_name->as_C_string(), c->_from_name->as_C_string(),
+                                c->_signature->as_C_string(), is_protected ? "" : "not ",
+                                ik->external_name());
+      }
+      return false;
+    }
+    return true;
+  }
+
+  bool assignable = VerificationType::resolve_and_check_assignability(ik, c->_name, c->_from_name,
+      (c->_flags & Constraint::_from_field_is_protected) != 0,
+      (c->_flags & Constraint::_from_is_array) != 0,
+      (c->_flags & Constraint::_from_is_object) != 0, CHECK_false);
+  if (assignable != ((c->_flags & Constraint::_assignable) != 0)) {
+    if (log_is_enabled(Debug, verification)) {
+      ResourceMark rm(THREAD);
+      log_debug(verification)("Verification cache: %s is %sassignable from %s for %s now",
+                              c->_name->as_C_string(), assignable ? "" : "not ",
+                              c->_from_name->as_C_string(), ik->external_name());
+    }
+    return false;
+  }
+  return true;
+}
+
+void VerificationCache::add(InstanceKlass* ik, GrowableArray<Constraint>* constraints) {
+  if (ik->is_rewritten()) {
+    // Verified recursively, so constraints misses the checks of the inner verification.
+    return;
+  }
+  Fingerprint fp;
+  if (!fingerprint(ik, &fp) || lookup(ik) != NULL) {
+    // Not fingerprinted, or the record did not match because of a changed
+    // superclass or constraint. The file keeps the old one then.
+    return;
+  }
+  int super_count = 0;
+  for (InstanceKlass* super = next_fingerprinted_super(ik);
+       super != NULL;
+       super = next_fingerprinted_super(super)) {
+    Fingerprint super_fp;
+    if (!fingerprint(super, &super_fp)) {
+      return;
+    }
+    super_count++;
+  }
+
+  Record* r = new Record(ik->name(), fp, super_count, constraints->length());
+  ik->name()->increment_refcount();
+  int i = 0;
+  for (InstanceKlass* super = ik->java_super(); i < super_count; super = next_fingerprinted_super(super), i++) {
+    // ik keeps its superclasses loaded, so their fingerprints stay recorded.
+    bool found = fingerprint(super, &r->_super_fingerprints[i]);
+    assert(found, "counted above");
+  }
+  for (i = 0; i < constraints->length(); i++) {
+    Constraint c = constraints->at(i);
+    // The names may be temporary symbols of the ClassVerifier.
+    c._name->increment_refcount();
+    c._from_name->increment_refcount();
+    if (c._signature != NULL) {
+      c._signature->increment_refcount();
+    }
+    r->_constraints[i] = c;
+  }
+
+  MutexLockerEx ml(VerificationCache_lock, Mutex::_no_safepoint_check_flag);
+  r->_next = _new_records;
+  _new_records = r;
+}
+
+static bool can_write(Symbol* name) {
+  if (name->utf8_length() >= max_name_length) {
+    return false;
+  }
+  for (int i = 0; i < name->utf8_length(); i++) {
+    if (isspace((unsigned char)name->byte_at(i))) {
+      return false;
+    }
+  }
+  return true;
+}
+
+void VerificationCache::write_record(FILE* file, Record* r) {
+  if (!can_write(r->_name)) {
+    return;
+  }
+  for (int i = 0; i < r->_constraint_count; i++) {
+    Constraint* c = &r->_constraints[i];
+    if (!can_write(c->_name) || !can_write(c->_from_name) ||
+        (c->_signature != NULL && !can_write(c->_signature))) {
+      return;
+    }
+  }
+  ResourceMark rm;
+  fprintf(file, "class %s ", r->_name->as_C_string());
+  r->_fingerprint.print_on(file);
+  fprintf(file, " %d %d\n", r->_super_count, r->_constraint_count);
+  for (int i = 0; i < r->_super_count; i++) {
+    fprintf(file, " ");
+    r->_super_fingerprints[i].print_on(file);
+    fprintf(file, "\n");
+  }
+  for (int i = 0; i < r->_constraint_count; i++) {
+    Constraint* c = &r->_constraints[i];
+    if (c->_signature != NULL) {
+      fprintf(file, " %s %s %d %s\n", c->_name->as_C_string(), c->_from_name->as_C_string(), c->_flags,
+              c->_signature->as_C_string());
+    } else {
+      fprintf(file, " %s %s %d\n", c->_name->as_C_string(), c->_from_name->as_C_string(), c->_flags);
+    }
+  }
+}
+
+// Rewrites the file if classes were added to it, through a temporary file so
+// that VMs starting concurrently read either version.
+void VerificationCache::write() {
+  Record* new_records;
+  {
+    MutexLockerEx ml(VerificationCache_lock, Mutex::_no_safepoint_check_flag);
+    new_records = _new_records;
+    _new_records = NULL;
+  }
+  if (new_records == NULL) {
+    return;
+  }
+
+  size_t len = strlen(_path) + 32;
+  char* temp_path = NEW_C_HEAP_ARRAY(char, len, mtClass);
+  jio_snprintf(temp_path, len, "%s.%d", _path, os::current_process_id());
+  FILE* file = fopen(temp_path, "w");
+  if (file == NULL) {
+    log_info(verification)("Cannot write verification cache %s", temp_path);
+    FREE_C_HEAP_ARRAY(char, temp_path);
+    return;
+  }
+  fprintf(file, "%s\n", VERIFICATION_CACHE_HEADER);
+  fprintf(file, "vm %s\n", VM_Version::internal_vm_info_string());
+  for (Record* r = _loaded_records; r != NULL; r = r->_next) {
+    write_record(file, r);
+  }
+  int count = 0;
+  for (Record* r = new_records; r != NULL; r = r->_next) {
+    write_record(file, r);
+    count++;
+  }
+  fclose(file);
+  if (::rename(temp_path, _path) != 0) {
+    remove(temp_path);
+  }
+  log_info(verification)("Added %d classes to verification cache %s", count, _path);
+  FREE_C_HEAP_ARRAY(char, temp_path);
+}
@@ -0,0 +1,112 @@
+/*
+ * Copyright (c) 2026, Alibaba Group Holding Limited. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+#ifndef SHARE_VM_CLASSFILE_VERIFICATIONCACHE_HPP
+#define SHARE_VM_CLASSFILE_VERIFICATIONCACHE_HPP
+
+#include "memory/allocation.hpp"
+#include "utilities/exceptions.hpp"
+#include "utilities/growableArray.hpp"
+
+class ClassFileStream;
+class InstanceKlass;
+class Symbol;
+
+// With -XX:+UseVerificationCache, classes the type checking verifier
+// accepted are recorded in VerificationCacheFile when the VM exits. In later
+// runs such a class is not verified again if
+//  - its class file has the same fingerprint, the SHA-256 digest of its bytes,
+//  - the class files of its superclasses that are not in the runtime image
+//    (including those of -Xbootclasspath/a) have the same fingerprints, and
+//  - the assignability checks the verifier had to resolve classes for, see
+//    VerificationType::is_reference_assignable_from(), and the protected
+//    access checks, see ClassVerifier::is_protected_access(), give the same
+//    results.
+// Everything else the verifier looks at is in these class files, so the
+// verifier would accept the class again.
+class VerificationCache : AllStatic {
+ public:
+  class Constraint {
+    friend class VerificationCache;
+
+    enum {
+      _from_field_is_protected = 1 << 0,
+      _from_is_array           = 1 << 1,
+      _from_is_object          = 1 << 2,
+      _assignable              = 1 << 3,
+      // A protected access check: _name is the class, _from_name and
+      // _signature are the member
+      _protected_access_check  = 1 << 4,
+      _is_method               = 1 << 5,
+      _is_protected_access     = 1 << 6
+    };
+
+    Symbol* _name;
+    Symbol* _from_name;
+    Symbol* _signature;
+    u1      _flags;
+
+   public:
+    Constraint() : _name(NULL), _from_name(NULL), _signature(NULL), _flags(0) {}
+    Constraint(Symbol* name, Symbol* from_name, bool from_field_is_protected,
+               bool from_is_array, bool from_is_object, bool assignable);
+
+    static Constraint protected_access(Symbol* klass_name, Symbol* member_name, Symbol* member_sig,
+                                       bool is_method, bool is_protected_access);
+  };
+
+  class Fingerprint;
+  class Record;
+
+ private:
+  static const char* _path;
+  static Record*     _loaded_records;
+  static Record*     _new_records;
+
+  static const char* default_path();
+  static void load(TRAPS);
+  static void write_record(FILE* file, Record* r);
+  static Record* lookup(InstanceKlass* ik);
+  static bool fingerprint(InstanceKlass* ik, Fingerprint* fp);
+  static InstanceKlass* next_fingerprinted_super(InstanceKlass* ik);
+  static bool supers_match(InstanceKlass* ik, Record* r);
+  static bool check_constraint(InstanceKlass* ik, Constraint* c, TRAPS);
+
+ public:
+  static void initialize(TRAPS);
+
+  // Remembers the fingerprint of the class file of ik, called when it is parsed.
+  static void record_fingerprint(InstanceKlass* ik, const ClassFileStream* stream);
+  static void klass_unloading(InstanceKlass* ik);
+
+  // True if the verification of ik can be skipped. Throws what resolving the
+  // classes of the recorded constraints throws.
+  static bool is_verified(InstanceKlass* ik, TRAPS);
+
+  // Records that the type checking verifier accepted ik with constraints.
+  static void add(InstanceKlass* ik, GrowableArray<Constraint>* constraints);
+
+  static void write();
+};
+
+#endif // SHARE_VM_CLASSFILE_VERIFICATIONCACHE_HPP
@@ -102,8 +102,13 @@ bool VerificationType::is_reference_assignable_from(
       return true;
     }
 
-    return resolve_and_check_assignability(klass, name(), from.name(),
-          from_field_is_protected, from.is_array(), from.is_object(), THREAD);
+    bool assignable = resolve_and_check_assignability(klass, name(), from.name(),
+          from_field_is_protected, from.is_array(), from.is_object(), CHECK_false);
+    if (context->cache_constraints() != NULL) {
+      context->cache_constraints()->append(VerificationCache::Constraint(name(), from.name(),
+          from_field_is_protected, from.is_array(), from.is_object(), assignable));
+    }
+    return assignable;
   } else if (is_array() && from.is_array()) {
     VerificationType comp_this = get_component(context, CHECK_false);
     VerificationType comp_from = from.get_component(context, CHECK_false);
@@ -30,6 +30,7 @@
 #include "classfile/stackMapFrame.hpp"
 #include "classfile/stackMapTableFormat.hpp"
 #include "classfile/systemDictionary.hpp"
+#include "classfile/verificationCache.hpp"
 #include "classfile/verifier.hpp"
 #include "classfile/vmSymbols.hpp"
 #include "interpreter/bytecodes.hpp"
@@ -181,11 +182,21 @@ bool Verifier::verify(InstanceKlass* klass, Verifier::Mode mode, bool should_ver
   bool can_failover = FailOverToOldVerifier &&
      klass->major_version() < NOFAILOVER_MAJOR_VERSION;
 
+  if (UseVerificationCache && klass->major_version() >= STACKMAP_ATTRIBUTE_MAJOR_VERSION &&
+      VerificationCache::is_verified(klass, CHECK_false)) {
+    log_info(class, init)("Skipped class verification for: %s (verification cache)", klassName);
+    log_info(verification)("Skipped class verification for: %s (verification cache)", klassName);
+    return true;
+  }
+
   log_info(class, init)("Start class verification for: %s", klassName);
   if (klass->major_version() >= STACKMAP_ATTRIBUTE_MAJOR_VERSION) {
     ClassVerifier split_verifier(klass, THREAD);
     split_verifier.verify_class(THREAD);
     exception_name = split_verifier.result();
+    if (UseVerificationCache && !HAS_PENDING_EXCEPTION && exception_name == NULL) {
+      VerificationCache::add(klass, split_verifier.cache_constraints());
+    }
     if (can_failover && !HAS_PENDING_EXCEPTION &&
         (exception_name == vmSymbols::java_lang_VerifyError() ||
          exception_name == vmSymbols::java_lang_ClassFormatError())) {
@@ -580,6 +591,7 @@ ClassVerifier::ClassVerifier(
   _this_type = VerificationType::reference_type(klass->name());
   // Create list to hold symbols in reference area.
   _symbols = new GrowableArray<Symbol*>(100, 0, NULL);
+  _cache_constraints = UseVerificationCache ? new GrowableArray<VerificationCache::Constraint>(16) : NULL;
 }
 
 ClassVerifier::~ClassVerifier() {
@@ -2037,6 +2049,20 @@ bool ClassVerifier::is_protected_access(InstanceKlass* this_class,
                                         Symbol* field_name,
                                         Symbol* field_sig,
                                         bool is_method) {
+  bool is_protected = check_protected_access(this_class, target_class, field_name,
+                                             field_sig, is_method);
+  if (_cache_constraints != NULL) {
+    _cache_constraints->append(VerificationCache::Constraint::protected_access(
+        target_class->name(), field_name, field_sig, is_method, is_protected));
+  }
+  return is_protected;
+}
+
+bool ClassVerifier::check_protected_access(InstanceKlass* this_class,
+                                           Klass* target_class,
+                                           Symbol* field_name,
+                                           Symbol* field_sig,
+                                           bool is_method) {
   NoSafepointVerifier nosafepoint;
 
   // If target class isn't a super class of this class, we don't worry about this case
@@ -2667,7 +2693,13 @@ void ClassVerifier::verify_invoke_init(
       // Do nothing if method is not found.  Let resolution detect the error.
       if (m != NULL) {
         InstanceKlass* mh = m->method_holder();
-        if (m->is_protected() && !mh->is_same_class_package(_klass)) {
+        bool is_protected = m->is_protected() && !mh->is_same_class_package(_klass);
+        if (_cache_constraints != NULL) {
+          _cache_constraints->append(VerificationCache::Constraint::protected_access(
+              ref_klass->name(), vmSymbols::object_initializer_name(),
+              cp->signature_ref_at(bcs->get_index_u2()), true, is_protected));
+        }
+        if (is_protected) {
           bool assignable = current_type().is_assignable_from(
             objectref_type, this, true, CHECK_VERIFY(this));
           if (!assignable) {
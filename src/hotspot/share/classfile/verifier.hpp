@@ -25,6 +25,7 @@
 #ifndef SHARE_VM_CLASSFILE_VERIFIER_HPP
 #define SHARE_VM_CLASSFILE_VERIFIER_HPP
 
+#include "classfile/verificationCache.hpp"
 #include "classfile/verificationType.hpp"
 #include "oops/klass.hpp"
 #include "oops/method.hpp"
@@ -257,6 +258,10 @@ class ClassVerifier : public StackObj {
   Thread* _thread;
   GrowableArray<Symbol*>* _symbols;  // keep a list of symbols created
 
+  // The assignability and protected access checks for the verification
+  // cache, NULL without it.
+  GrowableArray<VerificationCache::Constraint>* _cache_constraints;
+
   Symbol* _exception_type;
   char* _message;
 
@@ -380,6 +385,13 @@ class ClassVerifier : public StackObj {
   const methodHandle& method() { return _method; }
   InstanceKlass* current_class() const { return _klass; }
   VerificationType current_type() const { return _this_type; }
+  GrowableArray<VerificationCache::Constraint>* cache_constraints() const { return _cache_constraints; }
+
+  // True if the member of target_class is protected and this_class accesses
+  // it from another package.
+  static bool check_protected_access(
+    InstanceKlass* this_class, Klass* target_class,
+    Symbol* field_name, Symbol* field_sig, bool is_method);
 
   // Verifies the class.  If a verify or class file format error occurs,
   // the '_exception_name' symbols will set to the exception name and
@@ -280,15 +280,24 @@ void CodeCache::initialize_heaps() {
         non_nmethod_size/K, min_code_cache_size/K));
   }
 
+  // If large page support is enabled, align code heaps according to large
+  // page size to make sure that code cache is covered by large pages.
+  const size_t alignment = MAX2(page_size(false, 8), (size_t) os::vm_allocation_granularity());
+
+  // The hot code heap is taken out of the non-profiled code heap
+  size_t hot_size = 0;
+  if (heap_available(CodeBlobType::MethodHot)) {
+    hot_size = align_down(MIN2((size_t)HotCodeHeapSize, non_profiled_size / 2), alignment);
+    non_profiled_size -= hot_size;
+    FLAG_SET_ERGO(uintx, HotCodeHeapSize, hot_size);
+  }
+
   // Verify sizes and update flag values
-  assert(non_profiled_size + profiled_size + non_nmethod_size == cache_size, "Invalid code heap sizes");
+  assert(non_profiled_size + profiled_size + non_nmethod_size + hot_size == cache_size, "Invalid code heap sizes");
   FLAG_SET_ERGO(uintx, NonNMethodCodeHeapSize, non_nmethod_size);
   FLAG_SET_ERGO(uintx, ProfiledCodeHeapSize, profiled_size);
   FLAG_SET_ERGO(uintx, NonProfiledCodeHeapSize, non_profiled_size);
 
-  // If large page support is enabled, align code heaps according to large
-  // page size to make sure that code cache is covered by large pages.
-  const size_t alignment = MAX2(page_size(false, 8), (size_t) os::vm_allocation_granularity());
   non_nmethod_size = align_up(non_nmethod_size, alignment);
   profiled_size    = align_down(profiled_size, alignment);
   non_profiled_size = align_down(non_profiled_size, alignment);
@@ -297,6 +306,7 @@ void CodeCache::initialize_heaps() {
   // parts for the individual heaps. The memory layout looks like this:
   // ---------- high -----------
   //    Non-profiled nmethods
+  //        Hot nmethods
   //         Non-nmethods
   //      Profiled nmethods
   // ---------- low ------------
@@ -304,7 +314,9 @@ void CodeCache::initialize_heaps() {
   ReservedSpace profiled_space      = rs.first_part(profiled_size);
   ReservedSpace rest                = rs.last_part(profiled_size);
   ReservedSpace non_method_space    = rest.first_part(non_nmethod_size);
-  ReservedSpace non_profiled_space  = rest.last_part(non_nmethod_size);
+  rest                              = rest.last_part(non_nmethod_size);
+  ReservedSpace hot_space           = rest.first_part(hot_size);
+  ReservedSpace non_profiled_space  = rest.last_part(hot_size);
 
   // Non-nmethods (stubs, adapters, ...)
   add_heap(non_method_space, "CodeHeap 'non-nmethods'", CodeBlobType::NonNMethod);
@@ -312,6 +324,8 @@ void CodeCache::initialize_heaps() {
   add_heap(profiled_space, "CodeHeap 'profiled nmethods'", CodeBlobType::MethodProfiled);
   // Tier 1 and tier 4 (non-profiled) methods and native methods
   add_heap(non_profiled_space, "CodeHeap 'non-profiled nmethods'", CodeBlobType::MethodNonProfiled);
+  // Tier 4 methods that were hot when compiled
+  add_heap(hot_space, "CodeHeap 'hot nmethods'", CodeBlobType::MethodHot);
 }
 
 size_t CodeCache::page_size(bool aligned, size_t min_pages) {
@@ -346,6 +360,15 @@ ReservedCodeSpace CodeCache::reserve_heap_memory(size_t size) {
 
 // Heaps available for allocation
 bool CodeCache::heap_available(int code_blob_type) {
+  if (code_blob_type == CodeBlobType::MethodHot) {
+    // Only C2-compiled methods go into the hot code heap
+#ifdef COMPILER2
+    return HotCodeHeapSize > 0 && TieredStopAtLevel >= CompLevel_full_optimization &&
+           heap_available(CodeBlobType::MethodNonProfiled);
+#else
+    return false;
+#endif
+  }
   if (!SegmentedCodeCache) {
     // No segmentation: use a single code heap
     return (code_blob_type == CodeBlobType::All);
@@ -373,11 +396,26 @@ const char* CodeCache::get_code_heap_flag_name(int code_blob_type) {
   case CodeBlobType::MethodProfiled:
     return "ProfiledCodeHeapSize";
     break;
+  case CodeBlobType::MethodHot:
+    return "HotCodeHeapSize";
+    break;
   }
   ShouldNotReachHere();
   return NULL;
 }
 
+bool CodeCache::is_hot_method(Method* method) {
+  return (intx)method->invocation_count() + method->backedge_count() >= HotCodeMinInvocations;
+}
+
+int CodeCache::get_code_blob_type(Method* method, int comp_level) {
+  if (comp_level == CompLevel_full_optimization && heap_available(CodeBlobType::MethodHot) &&
+      is_hot_method(method)) {
+    return CodeBlobType::MethodHot;
+  }
+  return get_code_blob_type(comp_level);
+}
+
 int CodeCache::code_heap_compare(CodeHeap* const &lhs, CodeHeap* const &rhs) {
   if (lhs->code_blob_type() == rhs->code_blob_type()) {
     return (lhs > rhs) ? 1 : ((lhs < rhs) ? -1 : 0);
@@ -415,6 +453,11 @@ void CodeCache::add_heap(ReservedSpace rs, const char* name, int code_blob_type)
 
   // Reserve Space
   size_t size_initial = MIN2((size_t)InitialCodeCacheSize, rs.size());
+  if (code_blob_type == CodeBlobType::MethodHot) {
+    // Commit the hot code heap up front so that it is backed by large
+    // pages where they are available
+    size_initial = rs.size();
+  }
   size_initial = align_up(size_initial, os::vm_page_size());
   if (!heap->reserve(rs, size_initial, CodeCacheSegmentSize)) {
     vm_exit_during_initialization(err_msg("Could not reserve enough space in %s (" SIZE_FORMAT "K)",
@@ -507,6 +550,7 @@ CodeBlob* CodeCache::allocate(int size, int code_blob_type, int orig_code_blob_t
       if (SegmentedCodeCache) {
         // Fallback solution: Try to store code in another code heap.
         // NonNMethod -> MethodNonProfiled -> MethodProfiled (-> MethodNonProfiled)
+        // MethodHot -> MethodNonProfiled
         // Note that in the sweeper, we check the reverse_free_ratio of the code heap
         // and force stack scanning if less than 10% of the code heap are free.
         int type = code_blob_type;
@@ -523,6 +567,9 @@ CodeBlob* CodeCache::allocate(int size, int code_blob_type, int orig_code_blob_t
             type = CodeBlobType::MethodNonProfiled;
           }
           break;
+        case CodeBlobType::MethodHot:
+          type = CodeBlobType::MethodNonProfiled;
+          break;
         }
         if (type != code_blob_type && type != orig_code_blob_type && heap_available(type)) {
           if (PrintCodeCacheExtension) {
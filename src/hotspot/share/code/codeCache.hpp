@@ -249,17 +249,17 @@ class CodeCache : AllStatic {
   }
 
   static bool code_blob_type_accepts_compiled(int type) {
-    bool result = type == CodeBlobType::All || type <= CodeBlobType::MethodProfiled;
+    bool result = type == CodeBlobType::All || type <= CodeBlobType::MethodProfiled || type == CodeBlobType::MethodHot;
     AOT_ONLY( result = result || type == CodeBlobType::AOT; )
     return result;
   }
 
   static bool code_blob_type_accepts_nmethod(int type) {
-    return type == CodeBlobType::All || type <= CodeBlobType::MethodProfiled;
+    return type == CodeBlobType::All || type <= CodeBlobType::MethodProfiled || type == CodeBlobType::MethodHot;
   }
 
   static bool code_blob_type_accepts_allocable(int type) {
-    return type <= CodeBlobType::All;
+    return type <= CodeBlobType::All || type == CodeBlobType::MethodHot;
   }
 
 
@@ -279,6 +279,11 @@ class CodeCache : AllStatic {
     return 0;
   }
 
+  // Returns the CodeBlobType for an nmethod of the given method: hot methods
+  // compiled at the highest tier are placed in the hot code heap, if any.
+  static int get_code_blob_type(Method* method, int comp_level);
+  static bool is_hot_method(Method* method);
+
   static void verify_clean_inline_caches();
   static void verify_icholder_relocations();
 
@@ -232,6 +232,10 @@ class CompilationLog : public StringEventLog {
 
 static CompilationLog* _compilation_log = NULL;
 
+// Archive of the replay data of all compilations, see start_replay_capture().
+static fileStream* _replay_archive = NULL;
+static int         _replay_archive_count = 0;
+
 bool compileBroker_init() {
   if (LogEvents) {
     _compilation_log = new CompilationLog();
@@ -651,6 +655,10 @@ void CompileBroker::compilation_init_phase1(TRAPS) {
   }
 #endif // COMPILER2
 
+  if (ReplayCaptureFile != NULL) {
+    start_replay_capture(ReplayCaptureFile, NULL);
+  }
+
   // Start the compiler thread(s) and the sweeper thread
   init_compiler_sweeper_threads();
   // totalTime performance counter is always created as it is required
@@ -2168,40 +2176,48 @@ void CompileBroker::invoke_compiler_on_method(CompileTask* task) {
 
     ciMethod* target = ci_env.get_method_from_handle(target_handle);
 
-    TraceTime t1("compilation", &time);
-    EventCompilation event;
+    {
+      TraceTime t1("compilation", &time);
+      EventCompilation event;
 
-    if (comp == NULL) {
-      ci_env.record_method_not_compilable("no compiler", !TieredCompilation);
-    } else {
-      if (WhiteBoxAPI && WhiteBox::compilation_locked) {
-        MonitorLockerEx locker(Compilation_lock, Mutex::_no_safepoint_check_flag);
-        while (WhiteBox::compilation_locked) {
-          locker.wait(Mutex::_no_safepoint_check_flag);
+      if (comp == NULL) {
+        ci_env.record_method_not_compilable("no compiler", !TieredCompilation);
+      } else {
+        if (WhiteBoxAPI && WhiteBox::compilation_locked) {
+          MonitorLockerEx locker(Compilation_lock, Mutex::_no_safepoint_check_flag);
+          while (WhiteBox::compilation_locked) {
+            locker.wait(Mutex::_no_safepoint_check_flag);
+          }
         }
+        comp->compile_method(&ci_env, target, osr_bci, directive);
       }
-      comp->compile_method(&ci_env, target, osr_bci, directive);
-    }
 
-    if (!ci_env.failing() && task->code() == NULL) {
-      //assert(false, "compiler should always document failure");
-      // The compiler elected, without comment, not to register a result.
-      // Do not attempt further compilations of this method.
-      ci_env.record_method_not_compilable("compile failed", !TieredCompilation);
-    }
+      if (!ci_env.failing() && task->code() == NULL) {
+        //assert(false, "compiler should always document failure");
+        // The compiler elected, without comment, not to register a result.
+        // Do not attempt further compilations of this method.
+        ci_env.record_method_not_compilable("compile failed", !TieredCompilation);
+      }
+
+      // Copy this bit to the enclosing block:
+      compilable = ci_env.compilable();
 
-    // Copy this bit to the enclosing block:
-    compilable = ci_env.compilable();
+      if (ci_env.failing()) {
+        failure_reason = ci_env.failure_reason();
+        retry_message = ci_env.retry_message();
+        ci_env.report_failure(failure_reason);
+      }
 
-    if (ci_env.failing()) {
-      failure_reason = ci_env.failure_reason();
-      retry_message = ci_env.retry_message();
-      ci_env.report_failure(failure_reason);
+      post_compile(thread, task, !ci_env.failing(), &ci_env, compilable, failure_reason);
+      if (event.should_commit()) {
+        post_compilation_event(&event, task);
+      }
     }
 
-    post_compile(thread, task, !ci_env.failing(), &ci_env, compilable, failure_reason);
-    if (event.should_commit()) {
-      post_compilation_event(&event, task);
+    // Outside of the compilation time: dumping the replay data walks the
+    // ci objects of the whole compilation.
+    if (_replay_archive != NULL && !ci_env.failing()) {
+      capture_replay_data(&ci_env, task);
     }
   }
   // Remove the JNI handle block after the ciEnv destructor has run in
@@ -2842,3 +2858,82 @@ void CompileBroker::print_heapinfo(outputStream* out, const char* function, size
   }
   out->print_cr("\n__ CodeHeapStateAnalytics total duration %10.3f seconds _________\n", ts_total.seconds());
 }
+
+// ------------------------------------------------------------------
+// Replay data capture
+//
+// Appends the replay data of every successful compilation to one archive.
+// Each record is the content of a replay file, enclosed in comment lines
+// that the replay parser ignores:
+//
+//   # replay_record <compile_id> <comp_level> <osr_bci>
+//   ...
+//   # end_replay_record
+//
+// The records can be split up and replayed one by one with
+// -XX:+ReplayCompiles, e.g. by the ReplayCompiles launcher in src/utils.
+//
+// 'out' is the output of the diagnostic command, NULL when the capture
+// is started at startup by -XX:ReplayCaptureFile.
+bool CompileBroker::start_replay_capture(const char* file_name, outputStream* out) {
+  fileStream* archive = new(ResourceObj::C_HEAP, mtCompiler) fileStream(file_name, "w");
+  if (!archive->is_open()) {
+    if (out != NULL) {
+      out->print_cr("Could not open replay archive %s", file_name);
+    } else {
+      warning("Could not open replay archive %s", file_name);
+    }
+    delete archive;
+    return false;
+  }
+  archive->print_cr("# replay_archive pid %d", os::current_process_id());
+  fileStream* old_archive;
+  {
+    MutexLockerEx ml(CompileReplayArchive_lock, Mutex::_no_safepoint_check_flag);
+    old_archive = _replay_archive;
+    _replay_archive = archive;
+    _replay_archive_count = 0;
+  }
+  if (old_archive != NULL) {
+    delete old_archive;
+  }
+  if (out != NULL) {
+    out->print_cr("Capturing compiler replay data into %s", file_name);
+  } else {
+    log_info(jit, compilation)("Capturing compiler replay data into %s", file_name);
+  }
+  return true;
+}
+
+void CompileBroker::stop_replay_capture(outputStream* out) {
+  fileStream* archive;
+  int count;
+  {
+    MutexLockerEx ml(CompileReplayArchive_lock, Mutex::_no_safepoint_check_flag);
+    archive = _replay_archive;
+    count = _replay_archive_count;
+    _replay_archive = NULL;
+  }
+  if (archive == NULL) {
+    out->print_cr("Compiler replay data capture is not active");
+    return;
+  }
+  delete archive;
+  out->print_cr("Captured replay data of %d compilations", count);
+}
+
+void CompileBroker::capture_replay_data(ciEnv* env, CompileTask* task) {
+  // Dump into a C heap buffer first: taking Compile_lock while holding
+  // CompileReplayArchive_lock would violate the lock ranking.
+  bufferedStream record(4 * K, 64 * M);
+  env->dump_replay_data(&record);
+
+  MutexLockerEx ml(CompileReplayArchive_lock, Mutex::_no_safepoint_check_flag);
+  if (_replay_archive != NULL) {
+    _replay_archive->print_cr("# replay_record %d %d %d", task->compile_id(), task->comp_level(), task->osr_bci());
+    _replay_archive->write(record.base(), record.size());
+    _replay_archive->print_cr("# end_replay_record");
+    _replay_archive->flush();
+    _replay_archive_count++;
+  }
+}
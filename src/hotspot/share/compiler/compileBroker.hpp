@@ -257,6 +257,7 @@ class CompileBroker: AllStatic {
   static void push_jni_handle_block();
   static void pop_jni_handle_block();
   static void collect_statistics(CompilerThread* thread, elapsedTimer time, CompileTask* task);
+  static void capture_replay_data(ciEnv* env, CompileTask* task);
 
   static void compile_method_base(const methodHandle& method,
                                   int osr_bci,
@@ -421,6 +422,10 @@ public:
   // CodeHeap State Analytics.
   static void print_info(outputStream *out);
   static void print_heapinfo(outputStream *out, const char* function, size_t granularity);
+
+  // Replay data capture of all compilations into one archive (Compiler.replay_capture).
+  static bool start_replay_capture(const char* file_name, outputStream* out);
+  static void stop_replay_capture(outputStream* out);
 };
 
 #endif // SHARE_VM_COMPILER_COMPILEBROKER_HPP
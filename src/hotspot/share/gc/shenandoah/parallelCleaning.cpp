@@ -39,58 +39,42 @@ StringSymbolTableUnlinkTask::StringSymbolTableUnlinkTask(BoolObjectClosure* is_a
   _is_alive(is_alive),
   _par_state_string(StringTable::weak_storage()),
   _process_strings(process_strings), _strings_processed(0), _strings_removed(0),
-  _process_symbols(process_symbols), _symbols_processed(0), _symbols_removed(0) {
+  _process_symbols(process_symbols) {
 
   _initial_string_table_size = (int) StringTable::the_table()->table_size();
-  _initial_symbol_table_size = SymbolTable::the_table()->table_size();
-  if (process_symbols) {
-    SymbolTable::clear_parallel_claimed_index();
-  }
   if (process_strings) {
     StringTable::reset_dead_counter();
   }
 }
 
 StringSymbolTableUnlinkTask::~StringSymbolTableUnlinkTask() {
-  guarantee(!_process_symbols || SymbolTable::parallel_claimed_index() >= _initial_symbol_table_size,
-            "claim value %d after unlink less than initial symbol table size %d",
-            SymbolTable::parallel_claimed_index(), _initial_symbol_table_size);
-
   log_info(gc, stringtable)(
       "Cleaned string and symbol table, "
-      "strings: " SIZE_FORMAT " processed, " SIZE_FORMAT " removed, "
-      "symbols: " SIZE_FORMAT " processed, " SIZE_FORMAT " removed",
-      strings_processed(), strings_removed(),
-      symbols_processed(), symbols_removed());
+      "strings: " SIZE_FORMAT " processed, " SIZE_FORMAT " removed",
+      strings_processed(), strings_removed());
 
   if (_process_strings) {
     StringTable::finish_dead_counter();
   }
+  if (_process_symbols) {
+    // Dead symbols are unlinked concurrently by the ServiceThread.
+    SymbolTable::unlink();
+  }
 }
 
 void StringSymbolTableUnlinkTask::work(uint worker_id) {
   int strings_processed = 0;
   int strings_removed = 0;
-  int symbols_processed = 0;
-  int symbols_removed = 0;
   if (_process_strings) {
     StringTable::possibly_parallel_unlink(&_par_state_string, _is_alive, &strings_processed, &strings_removed);
     Atomic::add(strings_processed, &_strings_processed);
     Atomic::add(strings_removed, &_strings_removed);
   }
-  if (_process_symbols) {
-    SymbolTable::possibly_parallel_unlink(&symbols_processed, &symbols_removed);
-    Atomic::add(symbols_processed, &_symbols_processed);
-    Atomic::add(symbols_removed, &_symbols_removed);
-  }
 }
 
 size_t StringSymbolTableUnlinkTask::strings_processed() const { return (size_t)_strings_processed; }
 size_t StringSymbolTableUnlinkTask::strings_removed()   const { return (size_t)_strings_removed; }
 
-size_t StringSymbolTableUnlinkTask::symbols_processed() const { return (size_t)_symbols_processed; }
-size_t StringSymbolTableUnlinkTask::symbols_removed()   const { return (size_t)_symbols_removed; }
-
 
 Monitor* CodeCacheUnloadingTask::_lock = new Monitor(Mutex::leaf, "Code Cache Unload lock", false, Monitor::_safepoint_check_never);
 
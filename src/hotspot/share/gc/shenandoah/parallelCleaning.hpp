@@ -34,15 +34,12 @@ private:
   BoolObjectClosure* _is_alive;
   OopStorage::ParState<false /* concurrent */, false /* const */> _par_state_string;
   int _initial_string_table_size;
-  int _initial_symbol_table_size;
 
   bool  _process_strings;
   volatile int _strings_processed;
   volatile int _strings_removed;
 
   bool  _process_symbols;
-  volatile int _symbols_processed;
-  volatile int _symbols_removed;
 
 public:
   StringSymbolTableUnlinkTask(BoolObjectClosure* is_alive, bool process_strings, bool process_symbols);
@@ -52,9 +49,6 @@ public:
 
   size_t strings_processed() const;
   size_t strings_removed()   const;
-
-  size_t symbols_processed() const;
-  size_t symbols_removed()   const;
 };
 
 class CodeCacheUnloadingTask {
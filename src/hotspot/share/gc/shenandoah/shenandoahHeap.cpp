@@ -1946,7 +1946,7 @@ void ShenandoahHeap::stw_unload_classes(bool full_gc) {
     ShenandoahGCSubPhase phase(full_gc ?
                                ShenandoahPhaseTimings::full_gc_purge_class_unload :
                                ShenandoahPhaseTimings::purge_class_unload);
-    purged_class = SystemDictionary::do_unloading(gc_timer());
+    purged_class = SystemDictionary::do_unloading(gc_timer(), true, _workers);
   }
   {
     ShenandoahPhaseTimings::Phase p = full_gc ?
@@ -274,7 +274,6 @@ ZWeakRootsIterator::ZWeakRootsIterator() :
     _jfr_weak(this) {
   assert(SafepointSynchronize::is_at_safepoint(), "Should be at safepoint");
   ZStatTimer timer(ZSubPhasePauseWeakRootsSetup);
-  SymbolTable::clear_parallel_claimed_index();
 }
 
 ZWeakRootsIterator::~ZWeakRootsIterator() {
@@ -295,8 +294,7 @@ void ZWeakRootsIterator::do_jfr_weak(BoolObjectClosure* is_alive, ZRootsIterator
 
 void ZWeakRootsIterator::do_symbol_table(BoolObjectClosure* is_alive, ZRootsIteratorClosure* cl) {
   ZStatTimer timer(ZSubPhasePauseWeakRootsSymbolTable);
-  int dummy;
-  SymbolTable::possibly_parallel_unlink(&dummy, &dummy);
+  SymbolTable::unlink();
 }
 
 void ZWeakRootsIterator::weak_oops_do(BoolObjectClosure* is_alive, ZRootsIteratorClosure* cl) {
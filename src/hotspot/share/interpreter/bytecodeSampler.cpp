@@ -0,0 +1,347 @@
+/*
+ * Copyright (c) 2026, Alibaba Group Holding Limited. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+#include "precompiled.hpp"
+#include "interpreter/bytecodeSampler.hpp"
+#include "interpreter/bytecodes.hpp"
+#include "jfr/jfrEvents.hpp"
+#include "jfr/support/jfrThreadId.hpp"
+#include "logging/log.hpp"
+#include "memory/resourceArea.hpp"
+#include "oops/method.hpp"
+#include "oops/symbol.hpp"
+#include "runtime/frame.inline.hpp"
+#include "runtime/mutexLocker.hpp"
+#include "runtime/os.hpp"
+#include "runtime/thread.inline.hpp"
+#include "runtime/threadSMR.hpp"
+#include "utilities/growableArray.hpp"
+#include "utilities/resourceHash.hpp"
+
+// Samples are counted per method and bci. The method is identified by its
+// symbols, which the table keeps alive, so that the entries survive the
+// unloading of the sampled class.
+struct BytecodeSampleKey {
+  Symbol* _klass;
+  Symbol* _name;
+  Symbol* _signature;
+  int     _bci;
+
+  static unsigned hash(BytecodeSampleKey const& key) {
+    return key._klass->identity_hash() * 31 + key._name->identity_hash() * 17 +
+           key._signature->identity_hash() + (unsigned)key._bci;
+  }
+
+  static bool equals(BytecodeSampleKey const& a, BytecodeSampleKey const& b) {
+    return a._klass == b._klass && a._name == b._name &&
+           a._signature == b._signature && a._bci == b._bci;
+  }
+};
+
+struct BytecodeSampleCount {
+  Bytecodes::Code _code;
+  u8              _count;
+};
+
+typedef ResourceHashtable<BytecodeSampleKey, BytecodeSampleCount,
+                          BytecodeSampleKey::hash, BytecodeSampleKey::equals,
+                          1009, ResourceObj::C_HEAP, mtInternal> BytecodeSampleTable;
+
+static BytecodeSampleTable* _samples = NULL;  // protected by BytecodeSampler_lock
+static u8 _total_samples = 0;
+
+// Threads suspended per sampling round, like JfrThreadSampler's
+// MAX_NR_OF_JAVA_SAMPLES this bounds the time the Threads_lock is held.
+static const uint MAX_THREADS_PER_ROUND = 16;
+
+// Takes the sample while the target is suspended. Nothing may be allocated
+// or locked here, the target might hold the lock.
+class BytecodeSampleTask : public os::SuspendedThreadTask {
+  Method* _method;
+  int     _bci;
+ public:
+  BytecodeSampleTask(JavaThread* thread) :
+    os::SuspendedThreadTask(thread), _method(NULL), _bci(-1) {}
+
+  void do_task(const os::SuspendedThreadTaskContext& context);
+  void protected_task(const os::SuspendedThreadTaskContext& context);
+
+  Method* method() const { return _method; }
+  int     bci() const    { return _bci; }
+};
+
+class BytecodeSampleCallback : public os::CrashProtectionCallback {
+  BytecodeSampleTask& _task;
+  const os::SuspendedThreadTaskContext& _context;
+ public:
+  BytecodeSampleCallback(BytecodeSampleTask& task, const os::SuspendedThreadTaskContext& context) :
+    _task(task), _context(context) {}
+  virtual void call() {
+    _task.protected_task(_context);
+  }
+};
+
+void BytecodeSampleTask::do_task(const os::SuspendedThreadTaskContext& context) {
+  BytecodeSampleCallback cb(*this, context);
+  os::ThreadCrashProtection crash_protection;
+  if (!crash_protection.call(cb)) {
+    log_error(interpreter)("Bytecode sampler crashed");
+    _method = NULL;
+  }
+}
+
+void BytecodeSampleTask::protected_task(const os::SuspendedThreadTaskContext& context) {
+  JavaThread* jt = (JavaThread*)context.thread();
+  // Skip the sample if the thread moved to another state
+  if (jt->thread_state() != _thread_in_Java) {
+    return;
+  }
+  frame top;
+  if (!jt->pd_get_top_frame_for_signal_handler(&top, context.ucontext(), true)) {
+    return;
+  }
+  if (!top.is_interpreted_frame() || !top.is_interpreted_frame_valid(jt)) {
+    return;
+  }
+  // The interpreter keeps the bcp in a register and stores it into the
+  // frame before calls, so this is the last call site or branch in the
+  // method rather than the exact bytecode.
+  Method* method = top.interpreter_frame_method();
+  int bci = method->validate_bci_from_bcp(top.interpreter_frame_bcp());
+  if (bci >= 0) {
+    _bci = bci;
+    _method = method;
+  }
+}
+
+class BytecodeSamplerThread : public NonJavaThread {
+  uint _next_index;
+
+  void sample_threads();
+  void record(JavaThread* thread, Method* method, int bci);
+ public:
+  BytecodeSamplerThread() : NonJavaThread(), _next_index(0) {}
+
+  void run();
+  char* name() const { return (char*)"Bytecode Sampler"; }
+};
+
+static BytecodeSamplerThread* _sampler_thread = NULL;
+static volatile bool _should_terminate = false;  // protected by BytecodeSampler_lock
+
+void BytecodeSamplerThread::run() {
+  while (true) {
+    {
+      MonitorLockerEx ml(BytecodeSampler_lock, Mutex::_no_safepoint_check_flag);
+      if (!_should_terminate) {
+        ml.wait(Mutex::_no_safepoint_check_flag, BytecodeSamplingInterval);
+      }
+      if (_should_terminate) {
+        break;
+      }
+    }
+    sample_threads();
+  }
+
+  // Signal that it is terminated
+  {
+    MutexLockerEx mu(Terminator_lock, Mutex::_no_safepoint_check_flag);
+    _sampler_thread = NULL;
+    Terminator_lock->notify();
+  }
+}
+
+void BytecodeSamplerThread::sample_threads() {
+  MutexLockerEx tlock(Threads_lock, Mutex::_allow_vm_block_flag);
+  ThreadsListHandle tlh;
+  const uint length = tlh.length();
+  uint attempts = 0;
+  for (uint i = 0; i < length && attempts < MAX_THREADS_PER_ROUND; i++) {
+    JavaThread* jt = tlh.thread_at((_next_index + i) % length);
+    if (jt->is_Compiler_thread() || jt->is_hidden_from_external_view() ||
+        jt->in_deopt_handler() || jt->thread_state() != _thread_in_Java) {
+      continue;
+    }
+    attempts++;
+    BytecodeSampleTask task(jt);
+    task.run();
+    if (task.method() != NULL) {
+      // The Threads_lock keeps safepoints and thus class unloading away,
+      // so the method is still alive.
+      record(jt, task.method(), task.bci());
+    }
+  }
+  _next_index = length > 0 ? (_next_index + attempts) % length : 0;
+}
+
+void BytecodeSamplerThread::record(JavaThread* thread, Method* method, int bci) {
+  Bytecodes::Code code = Bytecodes::code_at(method, method->bcp_from(bci));
+  EventInterpreterBytecodeSample event;
+  if (event.should_commit()) {
+    event.set_sampledThread(JFR_THREAD_ID(thread));
+    event.set_method(method);
+    event.set_bci(bci);
+    event.set_bytecode(Bytecodes::name(code));
+    event.commit();
+  }
+
+  BytecodeSampleKey key;
+  key._klass = method->klass_name();
+  key._name = method->name();
+  key._signature = method->signature();
+  key._bci = bci;
+  BytecodeSampleCount initial = { code, 0 };
+
+  MutexLockerEx ml(BytecodeSampler_lock, Mutex::_no_safepoint_check_flag);
+  bool created;
+  BytecodeSampleCount* count = _samples->put_if_absent(key, initial, &created);
+  if (created) {
+    key._klass->increment_refcount();
+    key._name->increment_refcount();
+    key._signature->increment_refcount();
+  }
+  count->_count++;
+  _total_samples++;
+}
+
+void BytecodeSampler::engage() {
+  if (BytecodeSamplingInterval <= 0) {
+    return;
+  }
+  _samples = new (ResourceObj::C_HEAP, mtInternal) BytecodeSampleTable();
+  _sampler_thread = new BytecodeSamplerThread();
+  if (os::create_thread(_sampler_thread, os::os_thread)) {
+    os::start_thread(_sampler_thread);
+    log_info(interpreter)("Bytecode sampler started, interval " INTX_FORMAT " ms", BytecodeSamplingInterval);
+  } else {
+    log_warning(interpreter)("Failed to create thread for bytecode sampling");
+    _sampler_thread = NULL;
+  }
+}
+
+void BytecodeSampler::disengage() {
+  if (!is_active()) {
+    return;
+  }
+  {
+    MonitorLockerEx ml(BytecodeSampler_lock, Mutex::_no_safepoint_check_flag);
+    _should_terminate = true;
+    ml.notify();
+  }
+
+  MutexLocker mu(Terminator_lock);
+  while (_sampler_thread != NULL) {
+    Terminator_lock->wait(!Mutex::_no_safepoint_check_flag, 0,
+                          Mutex::_as_suspend_equivalent_flag);
+  }
+}
+
+bool BytecodeSampler::is_active() {
+  return _sampler_thread != NULL;
+}
+
+// A copy of a table entry. It holds references to the symbols of the key
+// so that it can be printed after a concurrent reset().
+struct BytecodeSampleEntry {
+  BytecodeSampleKey   _key;
+  BytecodeSampleCount _count;
+};
+
+static int compare_sample_counts(BytecodeSampleEntry* a, BytecodeSampleEntry* b) {
+  if (a->_count._count == b->_count._count) {
+    return 0;
+  }
+  return a->_count._count > b->_count._count ? -1 : 1;
+}
+
+class BytecodeSampleCollector : public StackObj {
+  GrowableArray<BytecodeSampleEntry>* _entries;
+ public:
+  BytecodeSampleCollector(GrowableArray<BytecodeSampleEntry>* entries) : _entries(entries) {}
+
+  bool do_entry(BytecodeSampleKey const& key, BytecodeSampleCount const& count) {
+    key._klass->increment_refcount();
+    key._name->increment_refcount();
+    key._signature->increment_refcount();
+    BytecodeSampleEntry entry = { key, count };
+    _entries->append(entry);
+    return true;
+  }
+};
+
+class BytecodeSampleReleaser : public StackObj {
+ public:
+  bool do_entry(BytecodeSampleKey const& key, BytecodeSampleCount const& count) {
+    key._klass->decrement_refcount();
+    key._name->decrement_refcount();
+    key._signature->decrement_refcount();
+    return true;
+  }
+};
+
+void BytecodeSampler::print_on(outputStream* st, int count) {
+  if (!is_active()) {
+    st->print_cr("Bytecode sampling is not enabled, see -XX:BytecodeSamplingInterval");
+    return;
+  }
+  ResourceMark rm;
+  // Copy the samples under the lock and print them after releasing it:
+  // the stream may block, e.g. on the socket of a jcmd client.
+  GrowableArray<BytecodeSampleEntry>* entries;
+  u8 total_samples;
+  {
+    MutexLockerEx ml(BytecodeSampler_lock, Mutex::_no_safepoint_check_flag);
+    entries = new GrowableArray<BytecodeSampleEntry>(MAX2(_samples->number_of_entries(), 1));
+    BytecodeSampleCollector collector(entries);
+    _samples->iterate(&collector);
+    total_samples = _total_samples;
+  }
+  entries->sort(compare_sample_counts);
+
+  st->print_cr("Bytecode samples: " UINT64_FORMAT " at %d distinct bytecodes", total_samples, entries->length());
+  st->print_cr("   samples      %%  bytecode              bci  method");
+  for (int i = 0; i < count && i < entries->length(); i++) {
+    const BytecodeSampleKey* key = &entries->at(i)._key;
+    const BytecodeSampleCount* c = &entries->at(i)._count;
+    st->print_cr(UINT64_FORMAT_W(10) " %6.2f  %-20s %5d  %s.%s%s",
+                 c->_count, 100.0 * c->_count / total_samples,
+                 Bytecodes::name(c->_code), key->_bci,
+                 key->_klass->as_klass_external_name(),
+                 key->_name->as_C_string(), key->_signature->as_C_string());
+  }
+
+  BytecodeSampleReleaser releaser;
+  for (int i = 0; i < entries->length(); i++) {
+    releaser.do_entry(entries->at(i)._key, entries->at(i)._count);
+  }
+}
+
+void BytecodeSampler::reset() {
+  if (!is_active()) {
+    return;
+  }
+  MutexLockerEx ml(BytecodeSampler_lock, Mutex::_no_safepoint_check_flag);
+  BytecodeSampleReleaser releaser;
+  _samples->unlink(&releaser);
+  _total_samples = 0;
+}
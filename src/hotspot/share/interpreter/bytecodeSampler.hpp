@@ -0,0 +1,51 @@
+/*
+ * Copyright (c) 2026, Alibaba Group Holding Limited. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+#ifndef SHARE_VM_INTERPRETER_BYTECODESAMPLER_HPP
+#define SHARE_VM_INTERPRETER_BYTECODESAMPLER_HPP
+
+#include "memory/allocation.hpp"
+
+class outputStream;
+
+// Sampling bytecode profiler for product builds. Every
+// BytecodeSamplingInterval ms a sampler thread suspends some of the threads
+// running Java code, the same way JfrThreadSampler takes execution samples,
+// and records the method, bci and bytecode of the interpreted ones. The
+// samples are counted per method and bci, printed by the
+// Interpreter.bytecode_samples diagnostic command and posted as
+// InterpreterBytecodeSample JFR events.
+class BytecodeSampler : AllStatic {
+ public:
+  // Starts the sampler thread if BytecodeSamplingInterval is set
+  static void engage();
+  // Stops the sampler thread at VM exit
+  static void disengage();
+  static bool is_active();
+
+  // Prints the count most frequently sampled bytecodes
+  static void print_on(outputStream* st, int count);
+  static void reset();
+};
+
+#endif // SHARE_VM_INTERPRETER_BYTECODESAMPLER_HPP
@@ -526,6 +526,13 @@ void Bytecodes::initialize() {
   def(_fast_iload2         , "fast_iload2"         , "bi_i" , NULL    , T_INT    ,  2, false, _iload);
   def(_fast_icaload        , "fast_icaload"        , "bi_"  , NULL    , T_INT    ,  0, false, _iload);
 
+  // Fused compare and branch: only the first iload is rewritten
+  def(_fast_iload_if_icmp   , "fast_iload_if_icmp"   , "bi"  , NULL    , T_VOID   ,  0, false, _iload);
+  def(_fast_iload_0_if_icmp , "fast_iload_0_if_icmp" , "b"   , NULL    , T_VOID   ,  0, false, _iload_0);
+  def(_fast_iload_1_if_icmp , "fast_iload_1_if_icmp" , "b"   , NULL    , T_VOID   ,  0, false, _iload_1);
+  def(_fast_iload_2_if_icmp , "fast_iload_2_if_icmp" , "b"   , NULL    , T_VOID   ,  0, false, _iload_2);
+  def(_fast_iload_3_if_icmp , "fast_iload_3_if_icmp" , "b"   , NULL    , T_VOID   ,  0, false, _iload_3);
+
   // Faster method invocation.
   def(_fast_invokevfinal   , "fast_invokevfinal"   , "bJJ"  , NULL    , T_ILLEGAL, -1, true, _invokevirtual   );
 
@@ -274,6 +274,14 @@ class Bytecodes: AllStatic {
     _fast_iload2          ,
     _fast_icaload         ,
 
+    // iload, iload, if_icmp<cond> fused by the Rewriter, named after
+    // the first load:
+    _fast_iload_if_icmp   ,
+    _fast_iload_0_if_icmp ,
+    _fast_iload_1_if_icmp ,
+    _fast_iload_2_if_icmp ,
+    _fast_iload_3_if_icmp ,
+
     _fast_invokevfinal    ,
     _fast_linearswitch    ,
     _fast_binaryswitch    ,
@@ -26,6 +26,7 @@
 #include "interpreter/bytecodes.hpp"
 #include "interpreter/interpreter.hpp"
 #include "interpreter/rewriter.hpp"
+#include "logging/log.hpp"
 #include "memory/metadataFactory.hpp"
 #include "memory/resourceArea.hpp"
 #include "oops/generateOopMap.hpp"
@@ -366,6 +367,61 @@ void Rewriter::maybe_rewrite_ldc(address bcp, int offset, bool is_wide,
 }
 
 
+#ifndef CC_INTERP
+// The fused bytecode for a sequence starting with the int load c, or
+// _illegal if c is not one
+static Bytecodes::Code fused_iload_if_icmp(Bytecodes::Code c) {
+  switch (c) {
+    case Bytecodes::_iload  : return Bytecodes::_fast_iload_if_icmp;
+    case Bytecodes::_iload_0: return Bytecodes::_fast_iload_0_if_icmp;
+    case Bytecodes::_iload_1: return Bytecodes::_fast_iload_1_if_icmp;
+    case Bytecodes::_iload_2: return Bytecodes::_fast_iload_2_if_icmp;
+    case Bytecodes::_iload_3: return Bytecodes::_fast_iload_3_if_icmp;
+    default:                  return Bytecodes::_illegal;
+  }
+}
+#endif
+
+// Rewrites the first load of each "iload, iload, if_icmp<cond>" sequence,
+// where either load may be an iload_<n>, into a bytecode the interpreter
+// executes without dispatching in between. The following bytecodes are
+// left alone, so branches into the middle of the sequence still find them.
+void Rewriter::fuse_bytecodes(Method* method) {
+#ifndef CC_INTERP
+  const address code_base = method->code_base();
+  const int code_length = method->code_size();
+
+  int bc_length;
+  for (int bci = 0; bci < code_length; bci += bc_length) {
+    address bcp = code_base + bci;
+    Bytecodes::Code c = (Bytecodes::Code)(*bcp);
+    bc_length = Bytecodes::length_for(c);
+    if (bc_length == 0) {
+      bc_length = Bytecodes::length_at(method, bcp);
+    }
+    Bytecodes::Code fused = fused_iload_if_icmp(c);
+    if (fused == Bytecodes::_illegal || bci + bc_length >= code_length) {
+      continue;
+    }
+    Bytecodes::Code second = (Bytecodes::Code)bcp[bc_length];
+    if (fused_iload_if_icmp(second) == Bytecodes::_illegal) {
+      continue;
+    }
+    int branch_bci = bci + bc_length + Bytecodes::length_for(second);
+    if (branch_bci < code_length &&
+        code_base[branch_bci] >= Bytecodes::_if_icmpeq &&
+        code_base[branch_bci] <= Bytecodes::_if_icmple) {
+      (*bcp) = fused;
+      ResourceMark rm;
+      log_trace(interpreter)("Fused %s, %s, %s at bci %d of %s",
+                             Bytecodes::name(c), Bytecodes::name(second),
+                             Bytecodes::name((Bytecodes::Code)code_base[branch_bci]),
+                             bci, method->name_and_sig_as_C_string());
+    }
+  }
+#endif
+}
+
 // Rewrites a method given the index_map information
 void Rewriter::scan_method(Method* method, bool reverse, bool* invokespecial_error) {
 
@@ -423,6 +479,14 @@ void Rewriter::scan_method(Method* method, bool reverse, bool* invokespecial_err
 #endif
         break;
       }
+      case Bytecodes::_fast_iload_if_icmp:
+      case Bytecodes::_fast_iload_0_if_icmp:
+      case Bytecodes::_fast_iload_1_if_icmp:
+      case Bytecodes::_fast_iload_2_if_icmp:
+      case Bytecodes::_fast_iload_3_if_icmp: {
+        (*bcp) = Bytecodes::java_code(c);  // if reverse=true
+        break;
+      }
 
       case Bytecodes::_invokespecial  : {
         rewrite_invokespecial(bcp, prefix_length+1, reverse, invokespecial_error);
@@ -494,6 +558,13 @@ void Rewriter::scan_method(Method* method, bool reverse, bool* invokespecial_err
     }
   }
 
+  // Methods with jsrs may be relocated later, which can widen the branches
+  // of a fused sequence. The CDS archive must not depend on the flag.
+  if (!reverse && nof_jsrs == 0 && RewriteFusedBytecodes && RewriteFrequentPairs &&
+      !DumpSharedSpaces) {
+    fuse_bytecodes(method);
+  }
+
   // Update access flags
   if (has_monitor_bytecodes) {
     method->set_has_monitor_bytecodes();
@@ -198,6 +198,7 @@ class Rewriter: public StackObj {
   void rewrite_invokedynamic(address bcp, int offset, bool reverse);
   void maybe_rewrite_ldc(address bcp, int offset, bool is_wide, bool reverse);
   void rewrite_invokespecial(address bcp, int offset, bool reverse, bool* invokespecial_error);
+  void fuse_bytecodes(Method* m);
 
   void patch_invokedynamic_bytecodes();
 
@@ -505,6 +505,14 @@ void TemplateTable::initialize() {
   def(Bytecodes::_fast_iload2         , ubcp|____|____|____, vtos, itos, fast_iload2         ,  _       );
   def(Bytecodes::_fast_icaload        , ubcp|____|____|____, vtos, itos, fast_icaload        ,  _       );
 
+  // The fused compare and branch bytecodes are only emitted with
+  // RewriteFusedBytecodes, platforms that support it define them in pd_initialize().
+  def(Bytecodes::_fast_iload_if_icmp  , ____|____|____|____, vtos, vtos, shouldnotreachhere ,  _           );
+  def(Bytecodes::_fast_iload_0_if_icmp, ____|____|____|____, vtos, vtos, shouldnotreachhere ,  _           );
+  def(Bytecodes::_fast_iload_1_if_icmp, ____|____|____|____, vtos, vtos, shouldnotreachhere ,  _           );
+  def(Bytecodes::_fast_iload_2_if_icmp, ____|____|____|____, vtos, vtos, shouldnotreachhere ,  _           );
+  def(Bytecodes::_fast_iload_3_if_icmp, ____|____|____|____, vtos, vtos, shouldnotreachhere ,  _           );
+
   def(Bytecodes::_fast_invokevfinal   , ubcp|disp|clvm|____, vtos, vtos, fast_invokevfinal   , f2_byte      );
 
   def(Bytecodes::_fast_linearswitch   , ubcp|disp|____|____, itos, vtos, fast_linearswitch   ,  _           );
@@ -47,6 +47,7 @@
 #include "memory/resourceArea.hpp"
 #include "oops/oop.inline.hpp"
 #include "runtime/arguments.hpp"
+#include "runtime/biasedLocking.hpp"
 #include "runtime/flags/jvmFlag.hpp"
 #include "runtime/globals.hpp"
 #include "runtime/os.hpp"
@@ -522,6 +523,18 @@ TRACE_REQUEST_FUNC(CompilerStatistics) {
   event.commit();
 }
 
+TRACE_REQUEST_FUNC(BiasedLockingStatistics) {
+  EventBiasedLockingStatistics event;
+  event.set_selfRevocations(BiasedLocking::self_revocations());
+  event.set_handshakeRevocations(BiasedLocking::handshake_revocations());
+  event.set_safepointRevocations(BiasedLocking::safepoint_revocations());
+  event.set_bulkRebiases(BiasedLocking::bulk_rebiases());
+  event.set_bulkRevocations(BiasedLocking::bulk_revocations());
+  event.set_handshakeTime(BiasedLocking::handshake_nanos());
+  event.set_safepointTime(BiasedLocking::safepoint_nanos());
+  event.commit();
+}
+
 TRACE_REQUEST_FUNC(CompilerConfiguration) {
   EventCompilerConfiguration event;
   event.set_threadCount(CICompilerCount);
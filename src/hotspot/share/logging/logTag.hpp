@@ -155,6 +155,7 @@
   LOG_TAG(subclass) \
   LOG_TAG(survivor) \
   LOG_TAG(sweep) \
+  LOG_TAG(symboltable) \
   LOG_TAG(system) \
   LOG_TAG(table) \
   LOG_TAG(task) \
@@ -232,6 +232,9 @@ protected:
   static void free_malloced_objects(Chunk* chunk, char* hwm, char* max, char* hwm2)  PRODUCT_RETURN;
   static void free_all(char** start, char** end)                                     PRODUCT_RETURN;
 
+  // Total # of bytes allocated in all arenas since start
+  NOT_PRODUCT(static julong bytes_allocated() { return _bytes_allocated; })
+
 private:
   // Reset this Arena to empty, access will trigger grow if necessary
   void   reset(void) {
@@ -41,6 +41,7 @@ class Mutex;
 
 template <class Chunk_t, class FreeList_t> class TreeChunk;
 template <class Chunk_t, class FreeList_t> class BinaryTreeDictionary;
+template <class Chunk_t, class FreeList_t> class TreeCensusClosure;
 template <class Chunk_t, class FreeList_t> class AscendTreeCensusClosure;
 template <class Chunk_t, class FreeList_t> class DescendTreeCensusClosure;
 template <class Chunk_t, class FreeList_t> class DescendTreeSearchClosure;
@@ -289,6 +290,11 @@ class BinaryTreeDictionary: public CHeapObj<mtGC> {
     return sum_of_squared_block_sizes(root());
   }
 
+  // Applies the closure to the lists of the tree.
+  void       apply(TreeCensusClosure<Chunk_t, FreeList_t>* cl) const {
+    cl->do_tree(root());
+  }
+
   Chunk_t* find_chunk_ends_at(HeapWord* target) const;
 
   // Return the largest free chunk in the tree.
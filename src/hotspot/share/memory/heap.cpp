@@ -569,6 +569,16 @@ size_t CodeHeap::heap_unallocated_capacity() const {
   return segments_to_size(_number_of_reserved_segments - _next_segment);
 }
 
+// Returns size of the largest block an allocation can be satisfied from
+// without expanding across used blocks.
+size_t CodeHeap::largest_free_block() const {
+  size_t max_segments = _number_of_reserved_segments - _next_segment;
+  for (FreeBlock* b = _freelist; b != NULL; b = b->link()) {
+    max_segments = MAX2(max_segments, b->length());
+  }
+  return segments_to_size(max_segments);
+}
+
 // Free list management
 
 FreeBlock* CodeHeap::following_block(FreeBlock *b) {
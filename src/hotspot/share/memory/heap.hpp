@@ -211,6 +211,7 @@ class CodeHeap : public CHeapObj<mtCode> {
   size_t allocated_capacity() const;
   size_t max_allocated_capacity() const          { return _max_allocated_capacity; }
   size_t unallocated_capacity() const            { return max_capacity() - allocated_capacity(); }
+  size_t largest_free_block() const;             // largest free block, including the never allocated tail
 
   // Returns true if the CodeHeap contains CodeBlobs of the given type
   bool accepts(int code_blob_type) const         { return (_code_blob_type == CodeBlobType::All) ||
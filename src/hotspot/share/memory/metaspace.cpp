@@ -1302,6 +1302,8 @@ void Metaspace::global_initialize() {
     // (!DumpSharedSpaces && !UseSharedSpaces) case to set up class
     // metaspace.
     MetaspaceShared::initialize_runtime_shared_and_meta_spaces();
+  } else if (ArchiveClassesAtExit != NULL) {
+    MetaspaceShared::archive_at_exit_not_mapped(false);
   }
 
   if (!DumpSharedSpaces && !UseSharedSpaces)
@@ -1481,6 +1483,11 @@ const char* Metaspace::metadata_type_name(Metaspace::MetadataType mdtype) {
 
 void Metaspace::purge(MetadataType mdtype) {
   get_space_list(mdtype)->purge(get_chunk_manager(mdtype));
+  if (MetaspaceUncommitFreeChunks) {
+    // Free chunks left over in the nodes which could not be purged still
+    // hold the pages of the unloaded metadata.
+    get_chunk_manager(mdtype)->uncommit_free_chunks();
+  }
 }
 
 void Metaspace::purge() {
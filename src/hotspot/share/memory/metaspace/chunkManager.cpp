@@ -34,6 +34,8 @@
 #include "memory/metaspace/occupancyMap.hpp"
 #include "memory/metaspace/virtualSpaceNode.hpp"
 #include "runtime/mutexLocker.hpp"
+#include "runtime/os.hpp"
+#include "utilities/align.hpp"
 #include "utilities/debug.hpp"
 #include "utilities/globalDefinitions.hpp"
 #include "utilities/ostream.hpp"
@@ -648,11 +650,72 @@ void ChunkManager::return_chunk_list(Metachunk* chunks) {
   }
 }
 
+// Walks free chunks and returns their memory to the OS, or just counts the
+// memory already returned. Only whole pages past the chunk header are
+// returned; for humongous chunks the header includes the dictionary node.
+class UncommitFreeChunksClosure : public AscendTreeCensusClosure<Metachunk, ChunkList> {
+  const bool _count_only;
+  size_t _words;
+
+ protected:
+  void do_list(ChunkList* fl) {
+    for (Metachunk* chunk = fl->head(); chunk != NULL; chunk = chunk->next()) {
+      do_chunk(chunk);
+    }
+  }
+
+ public:
+  UncommitFreeChunksClosure(bool count_only) : _count_only(count_only), _words(0) {}
+
+  size_t words() const { return _words; }
+
+  void do_chunk(Metachunk* chunk) {
+    assert(chunk->is_tagged_free(), "Chunk should be free.");
+    const size_t page_size = os::vm_page_size();
+    char* const start = align_up((char*)chunk + sizeof(TreeChunk<Metachunk, ChunkList>), page_size);
+    char* const end = align_down((char*)chunk->end(), page_size);
+    if (end <= start) {
+      return;
+    }
+    if (_count_only) {
+      if (chunk->is_uncommitted()) {
+        _words += pointer_delta(end, start, BytesPerWord);
+      }
+    } else if (!chunk->is_uncommitted()) {
+      os::free_memory(start, pointer_delta(end, start, 1), page_size);
+      chunk->set_is_uncommitted(true);
+      _words += pointer_delta(end, start, BytesPerWord);
+    }
+  }
+};
+
+size_t ChunkManager::uncommit_free_chunks() {
+  assert_lock_strong(MetaspaceExpand_lock);
+  UncommitFreeChunksClosure cl(false);
+  for (ChunkIndex i = ZeroIndex; i < NumberOfFreeLists; i = next_chunk_index(i)) {
+    for (Metachunk* chunk = free_chunks(i)->head(); chunk != NULL; chunk = chunk->next()) {
+      cl.do_chunk(chunk);
+    }
+  }
+  humongous_dictionary()->apply(&cl);
+  log_debug(gc, metaspace, freelist)("ChunkManager::uncommit_free_chunks: %s returned " SIZE_FORMAT " words.",
+                                     (is_class() ? "class space" : "metaspace"), cl.words());
+  return cl.words();
+}
+
 void ChunkManager::collect_statistics(ChunkManagerStatistics* out) const {
   MutexLockerEx cl(MetaspaceExpand_lock, Mutex::_no_safepoint_check_flag);
   for (ChunkIndex i = ZeroIndex; i < NumberOfInUseLists; i = next_chunk_index(i)) {
     out->chunk_stats(i).add(num_free_chunks(i), size_free_chunks_in_bytes(i) / sizeof(MetaWord));
   }
+  UncommitFreeChunksClosure ucl(true);
+  for (ChunkIndex i = ZeroIndex; i < NumberOfFreeLists; i = next_chunk_index(i)) {
+    for (Metachunk* chunk = _free_chunks[i].head(); chunk != NULL; chunk = chunk->next()) {
+      ucl.do_chunk(chunk);
+    }
+  }
+  _humongous_dictionary.apply(&ucl);
+  out->add_uncommitted(ucl.words());
 }
 
 } // namespace metaspace
@@ -156,6 +156,10 @@ class ChunkManager : public CHeapObj<mtInternal> {
   // Remove from a list by size.  Selects list based on size of chunk.
   Metachunk* free_chunks_get(size_t chunk_word_size);
 
+  // Return the memory of the free chunks to the OS, except for the pages
+  // holding the chunk headers. Returns the number of words returned.
+  size_t uncommit_free_chunks();
+
 #define index_bounds_check(index)                                         \
   assert(is_valid_chunktype(index), "Bad index: %d", (int) index)
 
@@ -56,6 +56,7 @@ Metachunk::Metachunk(ChunkIndex chunktype, bool is_class, size_t word_size,
     _chunk_type(chunktype),
     _is_class(is_class),
     _sentinel(CHUNK_SENTINEL),
+    _is_uncommitted(false),
     _origin(origin_normal),
     _use_count(0),
     _top(NULL),
@@ -164,6 +165,9 @@ void do_verify_chunk(Metachunk* chunk) {
 
 void do_update_in_use_info_for_chunk(Metachunk* chunk, bool inuse) {
   chunk->set_is_tagged_free(!inuse);
+  if (inuse) {
+    chunk->set_is_uncommitted(false);
+  }
   OccupancyMap* const ocmap = chunk->container()->occupancy_map();
   ocmap->set_region_in_use((MetaWord*)chunk, chunk->word_size(), inuse);
 }
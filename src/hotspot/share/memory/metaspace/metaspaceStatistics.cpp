@@ -60,10 +60,15 @@ void FreeChunksStatistics::print_on(outputStream* st, size_t scale) const {
 
 // ChunkManagerStatistics methods
 
+ChunkManagerStatistics::ChunkManagerStatistics()
+: _uncommitted(0)
+{}
+
 void ChunkManagerStatistics::reset() {
   for (ChunkIndex i = ZeroIndex; i < NumberOfInUseLists; i = next_chunk_index(i)) {
     _chunk_stats[i].reset();
   }
+  _uncommitted = 0;
 }
 
 size_t ChunkManagerStatistics::total_capacity() const {
@@ -90,6 +95,15 @@ void ChunkManagerStatistics::print_on(outputStream* st, size_t scale) const {
   st->print("%19s: " UINTX_FORMAT_W(4) ", capacity=", "Total", totals.num());
   print_scaled_words(st, totals.cap(), scale);
   st->cr();
+  // Free memory in chunks smaller than a medium chunk can only serve class
+  // loaders with few metadata, so a large share of it means fragmentation.
+  const size_t small_cap = _chunk_stats[SpecializedIndex].cap() + _chunk_stats[SmallIndex].cap();
+  st->print("%19s: ", "Below medium size");
+  print_scaled_words_and_percentage(st, small_cap, totals.cap(), scale);
+  st->cr();
+  st->print("%19s: ", "Uncommitted");
+  print_scaled_words_and_percentage(st, _uncommitted, totals.cap(), scale);
+  st->cr();
 }
 
 // UsedChunksStatistics methods
@@ -59,12 +59,20 @@ class ChunkManagerStatistics {
 
   FreeChunksStatistics _chunk_stats[NumberOfInUseLists];
 
+  // Free chunk memory returned to the OS, in words.
+  size_t _uncommitted;
+
 public:
 
+  ChunkManagerStatistics();
+
   // Free chunk statistics, by chunk index.
   const FreeChunksStatistics& chunk_stats(ChunkIndex index) const   { return _chunk_stats[index]; }
   FreeChunksStatistics& chunk_stats(ChunkIndex index)               { return _chunk_stats[index]; }
 
+  size_t uncommitted() const                                       { return _uncommitted; }
+  void add_uncommitted(size_t words)                               { _uncommitted += words; }
+
   void reset();
   size_t total_capacity() const;
 
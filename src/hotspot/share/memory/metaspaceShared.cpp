@@ -38,6 +38,7 @@
 #include "interpreter/bytecodes.hpp"
 #include "logging/log.hpp"
 #include "logging/logMessage.hpp"
+#include "logging/logStream.hpp"
 #include "memory/filemap.hpp"
 #include "memory/heapShared.inline.hpp"
 #include "memory/metaspace.hpp"
@@ -53,7 +54,12 @@
 #include "oops/oop.inline.hpp"
 #include "oops/typeArrayKlass.hpp"
 #include "prims/jvmtiRedefineClasses.hpp"
+#include "runtime/arguments.hpp"
+#include "runtime/flags/jvmFlag.hpp"
+#include "runtime/globals_extension.hpp"
 #include "runtime/handles.inline.hpp"
+#include "runtime/interfaceSupport.inline.hpp"
+#include "runtime/mutexLocker.hpp"
 #include "runtime/os.hpp"
 #include "runtime/quickStart.hpp"
 #include "runtime/safepointVerifiers.hpp"
@@ -65,6 +71,7 @@
 #include "utilities/bitMap.hpp"
 #include "utilities/defaultStream.hpp"
 #include "utilities/hashtable.inline.hpp"
+#include "utilities/ostream.hpp"
 #if INCLUDE_G1GC
 #include "gc/g1/g1Allocator.inline.hpp"
 #include "gc/g1/g1CollectedHeap.hpp"
@@ -80,6 +87,9 @@ bool MetaspaceShared::_open_archive_heap_region_mapped = false;
 address MetaspaceShared::_cds_i2i_entry_code_buffers = NULL;
 size_t MetaspaceShared::_cds_i2i_entry_code_buffers_size = 0;
 size_t MetaspaceShared::_core_spaces_size = 0;
+const char* MetaspaceShared::_archive_at_exit_classlist = NULL;
+bool MetaspaceShared::_owns_archive_at_exit_classlist = false;
+bool MetaspaceShared::_rearchive_at_exit = false;
 
 // The CDS archive is divided into the following regions:
 //     mc  - misc code (the method entry trampolines)
@@ -254,6 +264,9 @@ void MetaspaceShared::initialize_runtime_shared_and_meta_spaces() {
   } else {
     assert(!mapinfo->is_open() && !UseSharedSpaces,
            "archive file not closed or shared spaces not disabled.");
+    if (ArchiveClassesAtExit != NULL) {
+      archive_at_exit_not_mapped(true);
+    }
   }
 }
 
@@ -1697,6 +1710,152 @@ void MetaspaceShared::prepare_for_dumping() {
   ClassLoader::initialize_shared_path();
 }
 
+// Runs -Xshare:dump on the class list this run has recorded. The archive is
+// written to a temporary file first, so that VMs starting meanwhile never map
+// a partial archive.
+// The class list is named after the process, so that VMs running
+// concurrently do not write to the same file.
+void MetaspaceShared::record_classes_for_archive_at_exit() {
+  assert(ArchiveClassesAtExit != NULL, "sanity");
+  if (!FLAG_IS_DEFAULT(DumpLoadedClassList)) {
+    _archive_at_exit_classlist = DumpLoadedClassList;
+    return;
+  }
+  size_t len = strlen(ArchiveClassesAtExit) + 32;
+  char* list = NEW_C_HEAP_ARRAY(char, len, mtClass);
+  jio_snprintf(list, len, "%s.%d.classlist", ArchiveClassesAtExit, os::current_process_id());
+  FLAG_SET_ERGO(ccstr, DumpLoadedClassList, list);
+  FREE_C_HEAP_ARRAY(char, list);
+  _archive_at_exit_classlist = DumpLoadedClassList;
+  _owns_archive_at_exit_classlist = true;
+}
+
+void MetaspaceShared::archive_at_exit_not_mapped(bool mapping_failed) {
+  if (SharedArchiveFile == NULL || strcmp(SharedArchiveFile, ArchiveClassesAtExit) != 0 ||
+      _archive_at_exit_classlist != NULL) {
+    // The archive did not exist when the VM started
+    return;
+  }
+  if (!mapping_failed) {
+    log_warning(cds)("Sharing is disabled, %s is not used", ArchiveClassesAtExit);
+    return;
+  }
+  // Dumped by a VM with other flags, for instance. No class has been loaded
+  // yet, so the class list of this run is complete.
+  log_warning(cds)("Unable to map %s, archiving the loaded classes to it again at exit",
+                   ArchiveClassesAtExit);
+  record_classes_for_archive_at_exit();
+  if (classlist_file == NULL) {
+    classlist_file = new(ResourceObj::C_HEAP, mtInternal) fileStream(DumpLoadedClassList);
+  }
+  _rearchive_at_exit = true;
+}
+
+static void add_arg(GrowableArray<char*>* argv, const char* format, ...) ATTRIBUTE_PRINTF(2, 3);
+
+static void add_arg(GrowableArray<char*>* argv, const char* format, ...) {
+  va_list ap;
+  va_start(ap, format);
+  char buf[16];
+  va_list ap_copy;
+  va_copy(ap_copy, ap);
+  int len = os::vsnprintf(buf, sizeof(buf), format, ap_copy);
+  va_end(ap_copy);
+  char* arg = NEW_RESOURCE_ARRAY(char, len + 1);
+  os::vsnprintf(arg, len + 1, format, ap);
+  va_end(ap);
+  argv->append(arg);
+}
+
+// Forwards the bool flag if it exists in this VM. Flags selecting a GC are
+// only forwarded when they are set.
+static void add_bool_flag(GrowableArray<char*>* argv, const char* name, bool only_if_set) {
+  JVMFlag* flag = JVMFlag::find_flag(name);
+  if (flag != NULL && flag->is_bool() && (flag->get_bool() || !only_if_set)) {
+    add_arg(argv, "-XX:%c%s", flag->get_bool() ? '+' : '-', name);
+  }
+}
+
+void MetaspaceShared::archive_classes_at_exit(JavaThread* thread) {
+  assert(ArchiveClassesAtExit != NULL, "sanity");
+  struct stat st;
+  if (_archive_at_exit_classlist == NULL || classlist_file == NULL || !classlist_file->is_open() ||
+      (!_rearchive_at_exit && os::stat(ArchiveClassesAtExit, &st) == 0)) {
+    // Nothing recorded, or a VM running concurrently has dumped the archive already.
+    return;
+  }
+  {
+    MutexLocker mu(DumpLoadedClassList_lock, thread);
+    classlist_file->flush();
+  }
+
+  ResourceMark rm(thread);
+  char tmp_path[JVM_MAXPATHLEN];
+  jio_snprintf(tmp_path, sizeof(tmp_path), "%s.%d.tmp", ArchiveClassesAtExit, os::current_process_id());
+
+  // The archive maps only into a VM with the same heap and class pointer
+  // layout, the same GC and the same boot append and module paths.
+  GrowableArray<char*>* argv = new GrowableArray<char*>(32);
+  add_arg(argv, "%s%sbin%sjava", Arguments::get_java_home(), os::file_separator(), os::file_separator());
+  add_arg(argv, "-Xshare:dump");
+  add_arg(argv, "-XX:+UnlockExperimentalVMOptions");
+  add_arg(argv, "-XX:+AppCDSLegacyVerisonSupport");
+  add_arg(argv, "-XX:+DumpAppCDSWithKlassId");
+  if (EagerAppCDS) {
+    add_arg(argv, "-XX:+EagerAppCDS");
+  }
+  add_bool_flag(argv, "UseCompressedOops", false);
+  add_bool_flag(argv, "UseCompressedClassPointers", false);
+  add_arg(argv, "-XX:MaxHeapSize=" SIZE_FORMAT, MaxHeapSize);
+  add_arg(argv, "-XX:ObjectAlignmentInBytes=%d", ObjectAlignmentInBytes);
+  static const char* const gc_flags[] = {
+    "UseSerialGC", "UseParallelGC", "UseParallelOldGC", "UseConcMarkSweepGC",
+    "UseG1GC", "UseEpsilonGC", "UseZGC"
+  };
+  for (size_t i = 0; i < ARRAY_SIZE(gc_flags); i++) {
+    add_bool_flag(argv, gc_flags[i], true);
+  }
+  const char* boot_append = Arguments::get_jdk_boot_class_path_append();
+  if (boot_append != NULL && boot_append[0] != '\0') {
+    add_arg(argv, "-Xbootclasspath/a:%s", boot_append);
+  }
+  const char* module_path = Arguments::get_property("jdk.module.path");
+  if (module_path != NULL && module_path[0] != '\0') {
+    add_arg(argv, "--module-path");
+    add_arg(argv, "%s", module_path);
+  }
+  add_arg(argv, "-XX:SharedClassListFile=%s", _archive_at_exit_classlist);
+  add_arg(argv, "-XX:SharedArchiveFile=%s", tmp_path);
+  add_arg(argv, "-cp");
+  add_arg(argv, "%s", Arguments::get_appclasspath());
+
+  if (log_is_enabled(Info, cds)) {
+    LogStream ls(Log(cds)::info());
+    ls.print("Archiving loaded classes:");
+    for (int i = 0; i < argv->length(); i++) {
+      ls.print(" %s", argv->at(i));
+    }
+    ls.cr();
+  }
+  argv->append(NULL);
+
+  int status;
+  {
+    // The dump takes a while, do not hold up safepoints meanwhile.
+    ThreadToNativeFromVM ttn(thread);
+    status = os::fork_and_exec(argv->adr_at(0));
+  }
+  if (status == 0 && ::rename(tmp_path, ArchiveClassesAtExit) == 0) {
+    log_info(cds)("Archived loaded classes to %s", ArchiveClassesAtExit);
+  } else {
+    log_warning(cds)("Failed to archive loaded classes to %s, exit status %d", ArchiveClassesAtExit, status);
+    ::remove(tmp_path);
+  }
+  if (_owns_archive_at_exit_classlist) {
+    ::remove(_archive_at_exit_classlist);
+  }
+}
+
 // Preload classes from a list, populate the shared spaces and dump to a
 // file.
 void MetaspaceShared::preload_and_dump(TRAPS) {
@@ -62,6 +62,9 @@ class MetaspaceShared : AllStatic {
   static address _cds_i2i_entry_code_buffers;
   static size_t  _cds_i2i_entry_code_buffers_size;
   static size_t  _core_spaces_size;
+  static const char* _archive_at_exit_classlist;
+  static bool    _owns_archive_at_exit_classlist;
+  static bool    _rearchive_at_exit;
  public:
   enum {
     // core archive spaces
@@ -87,6 +90,12 @@ class MetaspaceShared : AllStatic {
   static void preload_and_dump(TRAPS) NOT_CDS_RETURN;
   static int preload_classes(const char * class_list_path,
                              TRAPS) NOT_CDS_RETURN_(0);
+  // Records the loaded classes for archive_classes_at_exit().
+  static void record_classes_for_archive_at_exit() NOT_CDS_RETURN;
+  // The archive of -XX:ArchiveClassesAtExit exists but is not mapped.
+  static void archive_at_exit_not_mapped(bool mapping_failed) NOT_CDS_RETURN;
+  // Dumps the classes recorded with -XX:ArchiveClassesAtExit into the archive.
+  static void archive_classes_at_exit(JavaThread* thread) NOT_CDS_RETURN;
 
 #if INCLUDE_CDS_JAVA_HEAP
  private:
@@ -43,7 +43,9 @@
 #include "prims/methodHandles.hpp"
 #include "runtime/atomic.hpp"
 #include "runtime/handles.inline.hpp"
+#include "runtime/interfaceSupport.inline.hpp"
 #include "runtime/orderAccess.hpp"
+#include "runtime/os.hpp"
 #include "utilities/macros.hpp"
 
 // Implementation of ConstantPoolCacheEntry
@@ -365,7 +367,20 @@ void ConstantPoolCacheEntry::set_method_handle_common(const constantPoolHandle&
   // or MethodType constant pool cache entries.
   assert(resolved_references() != NULL,
          "a resolved_references array should have been created for this class");
-  ObjectLocker ol(resolved_references, Thread::current());
+  const bool lock_free = LockFreeIndyResolution && invoke_code == Bytecodes::_invokedynamic;
+  ObjectLocker ol(resolved_references, Thread::current(), !lock_free);
+  if (lock_free) {
+    // The winner's appendix takes the slot right away; without an appendix
+    // the slot is unused and only holds the null sentinel.
+    oop claim = call_info.resolved_appendix().not_null() ? call_info.resolved_appendix()()
+                                                        : Universe::the_null_sentinel();
+    if (claim_indy_entry(resolved_references(), claim)) {
+      log_indy_claim(cpool, true);
+    } else {
+      log_indy_claim(cpool, false);
+      wait_for_indy_resolution();
+    }
+  }
   if (!is_f1_null()) {
     return;
   }
@@ -433,7 +448,7 @@ void ConstantPoolCacheEntry::set_method_handle_common(const constantPoolHandle&
   //
 
   // Store appendix, if any.
-  if (has_appendix) {
+  if (has_appendix && !lock_free) {
     const int appendix_index = f2_as_index() + _indy_resolved_references_appendix_offset;
     assert(appendix_index >= 0 && appendix_index < resolved_references->length(), "oob");
     assert(resolved_references->obj_at(appendix_index) == NULL, "init just once");
@@ -473,7 +488,16 @@ bool ConstantPoolCacheEntry::save_and_throw_indy_exc(
   objArrayHandle resolved_references(Thread::current(), cpool->resolved_references());
   assert(resolved_references() != NULL,
          "a resolved_references array should have been created for this class");
-  ObjectLocker ol(resolved_references, THREAD);
+  ObjectLocker ol(resolved_references, THREAD, !LockFreeIndyResolution);
+  if (LockFreeIndyResolution) {
+    // The exception is not stored, the slot only needs a non-null claim.
+    if (claim_indy_entry(resolved_references(), Universe::the_null_sentinel())) {
+      log_indy_claim(cpool, true);
+    } else {
+      log_indy_claim(cpool, false);
+      wait_for_indy_resolution();
+    }
+  }
 
   // if f1 is not null or the indy_resolution_failed flag is set then another
   // thread either succeeded in resolving the method or got a LinkageError
@@ -494,6 +518,32 @@ bool ConstantPoolCacheEntry::save_and_throw_indy_exc(
   return true;
 }
 
+bool ConstantPoolCacheEntry::claim_indy_entry(objArrayOop resolved_references, oop obj) {
+  assert(obj != NULL, "must claim with an object");
+  const int appendix_index = f2_as_index() + _indy_resolved_references_appendix_offset;
+  assert(appendix_index >= 0 && appendix_index < resolved_references->length(), "oob");
+  return resolved_references->atomic_compare_exchange_oop(appendix_index, obj, NULL) == NULL;
+}
+
+void ConstantPoolCacheEntry::log_indy_claim(const constantPoolHandle& cpool, bool won) {
+  if (log_is_enabled(Debug, constantpool, resolve)) {
+    ResourceMark rm;
+    log_debug(constantpool, resolve)("%s invokedynamic call site " INTPTR_FORMAT " of %s",
+                                     won ? "Claimed" : "Waiting for another thread to publish",
+                                     p2i(this), cpool->pool_holder()->external_name());
+  }
+}
+
+void ConstantPoolCacheEntry::wait_for_indy_resolution() {
+  // The winner may block on a lock to record a resolution error, so let
+  // safepoints proceed while waiting for it.
+  JavaThread* thread = JavaThread::current();
+  while (is_f1_null() && !indy_resolution_failed()) {
+    ThreadBlockInVM tbivm(thread);
+    os::naked_yield();
+  }
+}
+
 Method* ConstantPoolCacheEntry::method_if_resolved(const constantPoolHandle& cpool) {
   // Decode the action of set_method and set_interface_call
   Bytecodes::Code invoke_code = bytecode_1();
@@ -291,6 +291,14 @@ class ConstantPoolCacheEntry {
   bool save_and_throw_indy_exc(const constantPoolHandle& cpool, int cpool_index,
                                int index, constantTag tag, TRAPS);
 
+  // With LockFreeIndyResolution, threads racing to publish the result of an
+  // invokedynamic call site, or its resolution error, claim the entry by a
+  // CAS on its appendix slot instead of locking resolved_references. A loser
+  // discards its result and waits until the winner has published.
+  bool claim_indy_entry(objArrayOop resolved_references, oop obj);
+  void log_indy_claim(const constantPoolHandle& cpool, bool won);
+  void wait_for_indy_resolution();
+
   // invokedynamic and invokehandle call sites have two entries in the
   // resolved references array:
   //   appendix   (at index+0)
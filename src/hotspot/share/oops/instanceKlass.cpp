@@ -33,6 +33,7 @@
 #include "classfile/moduleEntry.hpp"
 #include "classfile/systemDictionary.hpp"
 #include "classfile/systemDictionaryShared.hpp"
+#include "classfile/verificationCache.hpp"
 #include "classfile/verifier.hpp"
 #include "classfile/vmSymbols.hpp"
 #include "code/codeCache.hpp"
@@ -41,6 +42,7 @@
 #include "gc/shared/collectedHeap.inline.hpp"
 #include "interpreter/oopMapCache.hpp"
 #include "interpreter/rewriter.hpp"
+#include "jfr/jfrEvents.hpp"
 #include "jvmtifiles/jvmti.h"
 #include "logging/log.hpp"
 #include "logging/logMessage.hpp"
@@ -913,6 +915,15 @@ void InstanceKlass::initialize_impl(TRAPS) {
 
   bool wait = false;
 
+  // Only the initializing thread sets or clears _init_thread for itself,
+  // so a recursive request needs no init_lock.
+  if (is_being_initialized() && is_reentrant_initialization(THREAD)) {
+    DTRACE_CLASSINIT_PROBE_WAIT(recursive, -1, wait);
+    return;
+  }
+
+  EventClassInitializationWait wait_event;
+
   // refer to the JVM book page 47 for description of steps
   // Step 1
   {
@@ -930,6 +941,11 @@ void InstanceKlass::initialize_impl(TRAPS) {
       ol.waitUninterruptibly(CHECK);
     }
 
+    if (wait && wait_event.should_commit()) {
+      wait_event.set_initializedClass(this);
+      wait_event.commit();
+    }
+
     // Step 3
     if (is_being_initialized() && is_reentrant_initialization(self)) {
       DTRACE_CLASSINIT_PROBE_WAIT(recursive, -1, wait);
@@ -2456,6 +2472,8 @@ void InstanceKlass::release_C_heap_structures() {
   // deallocated separately from the InstanceKlass for default methods and
   // redefine classes.
 
+  VerificationCache::klass_unloading(this);
+
   // Deallocate oop map cache
   if (_oop_map_cache != NULL) {
     delete _oop_map_cache;
@@ -3763,7 +3781,8 @@ void InstanceKlass::set_init_state(ClassState state) {
   assert(good_state || state == allocated, "illegal state transition");
   assert(_init_thread == NULL, "should be cleared before state change");
 #endif
-  _init_state = (u1)state;
+  // Pairs with the acquiring load of the clinit barrier in compiled code
+  OrderAccess::release_store(&_init_state, (u1)state);
 }
 
 #if INCLUDE_JVMTI
@@ -671,6 +671,13 @@ int Klass::atomic_incr_biased_lock_revocation_count() {
   return (int) Atomic::add(1, &_biased_lock_revocation_count);
 }
 
+void Klass::atomic_add_biased_lock_revocation_cost(int micros) {
+  // Saturate, the cost is reset by the next bulk operation
+  if (_biased_lock_revocation_cost < max_jint - micros) {
+    Atomic::add(micros, &_biased_lock_revocation_cost);
+  }
+}
+
 // Unless overridden, jvmti_class_status has no flags set.
 jint Klass::jvmti_class_status() const {
   return 0;
@@ -161,6 +161,7 @@ class Klass : public Metadata {
   jlong    _last_biased_lock_bulk_revocation_time;
   markOop  _prototype_header;   // Used when biased locking is both enabled and disabled for this type
   jint     _biased_lock_revocation_count;
+  jint     _biased_lock_revocation_cost;  // microseconds spent revoking single biases
 
   // vtable length
   int _vtable_len;
@@ -660,6 +661,9 @@ protected:
   // Atomically increments biased_lock_revocation_count and returns updated value
   int atomic_incr_biased_lock_revocation_count();
   void set_biased_lock_revocation_count(int val) { _biased_lock_revocation_count = (jint) val; }
+  int  biased_lock_revocation_cost() const { return (int) _biased_lock_revocation_cost; }
+  void set_biased_lock_revocation_cost(int val) { _biased_lock_revocation_cost = (jint) val; }
+  void atomic_add_biased_lock_revocation_cost(int micros);
   jlong last_biased_lock_bulk_revocation_time() { return _last_biased_lock_bulk_revocation_time; }
   void  set_last_biased_lock_bulk_revocation_time(jlong cur_time) { _last_biased_lock_bulk_revocation_time = cur_time; }
 
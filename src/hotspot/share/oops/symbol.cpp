@@ -26,6 +26,7 @@
 #include "precompiled.hpp"
 #include "classfile/altHashing.hpp"
 #include "classfile/classLoaderData.hpp"
+#include "classfile/symbolTable.hpp"
 #include "gc/shared/collectedHeap.hpp"
 #include "logging/log.hpp"
 #include "logging/logStream.hpp"
@@ -273,13 +274,44 @@ unsigned int Symbol::new_hash(juint seed) {
   return AltHashing::halfsiphash_32(seed, (const uint8_t*)as_C_string(), utf8_length());
 }
 
+// Callers own a reference already, so the count cannot be zero. A symbol
+// whose count went to zero may be removed by the concurrent cleaning and must
+// not be brought back.
 void Symbol::increment_refcount() {
-  // Only increment the refcount if non-negative.  If negative either
-  // overflow has occurred or it is a permanent symbol in a read only
-  // shared archive.
-  if (_refcount >= 0) { // not a permanent symbol
-    Atomic::inc(&_refcount);
-    NOT_PRODUCT(Atomic::inc(&_total_count);)
+  if (!try_increment_refcount()) {
+#ifdef ASSERT
+    print();
+#endif
+    fatal("refcount has gone to zero");
+  }
+}
+
+// The refcount is the most significant half of an aligned 32-bit word
+// (see ATOMIC_SHORT_PAIR), so it is updated with a cmpxchg on that word.
+bool Symbol::try_increment_refcount() {
+#ifdef VM_LITTLE_ENDIAN
+  volatile int* word = (volatile int*)(&_refcount - 1);
+#else
+  volatile int* word = (volatile int*)(&_refcount);
+#endif
+  int old_word = *word;
+  for (;;) {
+    short refc = (short)(old_word >> 16);
+    if (refc < 0) {
+      // Only increment the refcount if non-negative.  If negative either
+      // overflow has occurred or it is a permanent symbol in a read only
+      // shared archive.
+      return true;
+    }
+    if (refc == 0) {
+      return false;
+    }
+    int found = Atomic::cmpxchg(old_word + (1 << 16), word, old_word);
+    if (found == old_word) {
+      NOT_PRODUCT(Atomic::inc(&_total_count);)
+      return true;
+    }
+    old_word = found;
   }
 }
 
@@ -292,7 +324,9 @@ void Symbol::decrement_refcount() {
       assert(false, "reference count underflow for symbol");
     }
 #endif
-    (void)new_value;
+    if (new_value == 0) {
+      SymbolTable::item_dead();
+    }
   }
 }
 
@@ -38,8 +38,9 @@
 // All Symbols are allocated and added to the SymbolTable.
 // When a class is unloaded, the reference counts of the Symbol pointers in
 // the ConstantPool and in InstanceKlass (see release_C_heap_structures) are
-// decremented.  When the reference count for a Symbol goes to 0, the garbage
-// collector can free the Symbol and remove it from the SymbolTable.
+// decremented.  When the reference count for a Symbol goes to 0, the Symbol
+// is dead: lookups no longer return it and the ServiceThread concurrently
+// removes it from the SymbolTable and frees it.
 //
 // 0) Symbols need to be reference counted when a pointer to the Symbol is
 // saved in persistent storage.  This does not include the pointer
@@ -160,6 +161,9 @@ class Symbol : public MetaspaceObj {
   int refcount() const      { return _refcount; }
   void increment_refcount();
   void decrement_refcount();
+  // Fails if the symbol is dead, i.e. its reference count already dropped
+  // to zero and it may be freed concurrently. Used by SymbolTable lookups.
+  bool try_increment_refcount();
   bool is_permanent() {
     return (_refcount == PERM_REFCOUNT);
   }
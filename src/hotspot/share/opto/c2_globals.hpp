@@ -772,6 +772,15 @@
           "Loop with fewer iterations are not strip mined")                 \
           range(0, max_juint)                                               \
                                                                             \
+  experimental(bool, UseLongCountedLoops, false,                            \
+          "Transform long indexed loops into a loop nest with an int "      \
+          "counted inner loop")                                             \
+                                                                            \
+  develop(uintx, StressLongCountedLoop, 0,                                  \
+          "if > 0, run the int inner loop of a long counted loop nest "     \
+          "for at most max_jint / StressLongCountedLoop iterations")        \
+          range(0, max_juint)                                               \
+                                                                            \
   product(bool, UseProfiledLoopPredicate, true,                             \
           "move predicates out of loops based on profiling data")           \
 
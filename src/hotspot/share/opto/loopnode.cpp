@@ -1112,6 +1112,214 @@ bool PhaseIdealLoop::has_dominating_loop_limit_check(Node* init_trip, Node* limi
   return found_dominating_test;
 }
 
+//------------------------------is_long_counted_loop---------------------------
+// Loops with a long induction variable are never converted to counted
+// loops which leaves them out of range check elimination, unrolling and
+// vectorization. Transform such a loop into a loop nest: the outer loop
+// keeps the long induction variable and the original exit test, the inner
+// loop iterates an int induction variable for at most max_jint - stride
+// iterations. The inner loop has the shape of a counted loop and is
+// converted by the next round of loop opts.
+//
+//   long i = init;                    long i = init;
+//   do {                              do {
+//     ...                               int j = 0;
+//     i += stride;          ==>         int l = clamp(limit - i);
+//   } while (i < limit);                do {
+//                                         ... (uses i + j)
+//                                         j += stride;
+//                                       } while (j < l);
+//                                       i += j;
+//                                     } while (i < limit);
+//
+// The inner limit is clamped so that the inner exit test can only exit
+// early, never late: the outer exit test then decides whether to iterate
+// again. The safepoint ahead of the exit test is cloned on the backedge of
+// the outer loop so the nest still polls once the inner loop is counted
+// and its safepoint removed.
+bool PhaseIdealLoop::is_long_counted_loop(Node* x, IdealLoopTree* loop) {
+  // Only simple, innermost loops
+  if (x->Opcode() != Op_Loop || x->req() != 3 || loop->_irreducible || loop->_child != NULL) {
+    return false;
+  }
+  Node* init_control = x->in(LoopNode::EntryControl);
+  Node* back_control = x->in(LoopNode::LoopBackControl);
+  if (init_control == NULL || back_control == NULL ||
+      init_control->is_top() || back_control->is_top()) {
+    return false;
+  }
+  // A safepoint on the backedge would end up between the inner and
+  // outer loop exit tests. Give up on that loop.
+  uint iftrue_op = back_control->Opcode();
+  if (iftrue_op != Op_IfTrue && iftrue_op != Op_IfFalse) {
+    return false;
+  }
+  IfNode* iff = back_control->in(0)->as_If();
+  if (get_loop(iff) != loop || !iff->in(1)->is_Bool()) {
+    return false;
+  }
+  BoolTest::mask bt = iff->in(1)->as_Bool()->_test._test;
+  float cl_prob = iff->_prob;
+  if (iftrue_op == Op_IfFalse) {
+    bt = BoolTest(bt).negate();
+    cl_prob = 1.0 - cl_prob;
+  }
+  Node* cmp = iff->in(1)->in(1);
+  if (cmp->Opcode() != Op_CmpL) {
+    return false;
+  }
+  Node* incr = cmp->in(1);
+  Node* limit = cmp->in(2);
+  if (!is_member(loop, get_ctrl(incr))) {
+    swap(incr, limit);
+    bt = BoolTest(bt).commute();
+  }
+  if (is_member(loop, get_ctrl(limit)) || !is_member(loop, get_ctrl(incr))) {
+    return false;
+  }
+  // The exit test must be on the incremented value: i += stride; i < limit
+  if (incr->Opcode() != Op_AddL) {
+    return false;
+  }
+  Node* xphi = incr->in(1);
+  Node* stride = incr->in(2);
+  if (!stride->is_Con()) {
+    if (!xphi->is_Con()) {
+      return false;
+    }
+    swap(xphi, stride);
+  }
+  if (!xphi->is_Phi() || xphi->in(0) != x || xphi->req() != 3 ||
+      xphi->in(LoopNode::LoopBackControl) != incr) {
+    return false;
+  }
+  PhiNode* phi = xphi->as_Phi();
+
+  // The int inner loop must not overflow its induction variable:
+  // stride must fit in an int.
+  jlong stride_con = stride->get_long();
+  if (stride_con == 0 || stride_con != (jlong)(jint)stride_con) {
+    return false;
+  }
+  // Only loops that count towards their limit
+  if (!((stride_con > 0 && (bt == BoolTest::lt || bt == BoolTest::le)) ||
+        (stride_con < 0 && (bt == BoolTest::gt || bt == BoolTest::ge)))) {
+    return false;
+  }
+
+  // Number of iterations of the inner loop: -1 so no loop limit check
+  // is needed when the exit test is <= or >=.
+  jlong iters_limit = max_jint - ABS(stride_con) - 1;
+#ifdef ASSERT
+  if (StressLongCountedLoop > 0) {
+    iters_limit = iters_limit / StressLongCountedLoop;
+  }
+#endif
+  // At least 2 iterations so the counted loop construction doesn't fail
+  if (iters_limit / ABS(stride_con) < 2) {
+    return false;
+  }
+
+  // =================================================
+  // ---- SUCCESS!   Found A Long-Counted Loop!  -----
+  //
+  C->print_method(PHASE_BEFORE_CLOOPS, 3);
+
+  // A safepoint immediately preceding the exit test has the jvm state of
+  // the backward branch, which also holds on the outer loop's backedge:
+  // that path is only taken right after the inner loop exits there. It
+  // is the one counted loop conversion removes from the inner loop; any
+  // other safepoint stays in the inner loop.
+  Node* outer_back_control = back_control;
+  Node* sfpt = iff->in(0);
+  if (sfpt->Opcode() == Op_SafePoint) {
+    Node* outer_sfpt = sfpt->clone();
+    outer_sfpt->set_req(0, back_control);
+    _igvn.register_new_node_with_optimizer(outer_sfpt);
+    outer_back_control = outer_sfpt;
+  }
+
+  // Outer loop: takes the original entry and the original backedge
+  Node* outer_head = new LoopNode(init_control, outer_back_control);
+  _igvn.register_new_node_with_optimizer(outer_head);
+  Node* outer_phi = new PhiNode(outer_head, TypeLong::LONG);
+  outer_phi->init_req(LoopNode::EntryControl, phi->in(LoopNode::EntryControl));
+  outer_phi->init_req(LoopNode::LoopBackControl, incr);
+  _igvn.register_new_node_with_optimizer(outer_phi);
+
+  // Every other phi of the loop (memory state, accumulators) carries its
+  // value from one outer iteration to the next through a phi of the outer
+  // loop: it is entered with the original entry value and the value at the
+  // end of the inner loop.
+  Node_List other_phis;
+  for (DUIterator_Fast imax, i = x->fast_outs(imax); i < imax; i++) {
+    Node* u = x->fast_out(i);
+    if (u->is_Phi() && u != phi && u->in(0) == x) {
+      other_phis.push(u);
+    }
+  }
+  for (uint i = 0; i < other_phis.size(); i++) {
+    Node* u = other_phis.at(i);
+    Node* outer_u = u->clone();
+    outer_u->set_req(0, outer_head);
+    _igvn.register_new_node_with_optimizer(outer_u);
+    _igvn.replace_input_of(u, LoopNode::EntryControl, outer_u);
+  }
+
+  // Remaining distance to the limit, clamped so it can't wrap. If the
+  // limit is already passed the inner loop executes a single iteration.
+  Node* zero = _igvn.longcon(0);
+  Node* bound = _igvn.longcon(stride_con > 0 ? iters_limit : -iters_limit);
+  Node* range = _igvn.register_new_node_with_optimizer(new SubLNode(limit, outer_phi));
+  Node* passed_cmp = _igvn.register_new_node_with_optimizer(new CmpLNode(limit, outer_phi));
+  Node* passed_bol = _igvn.register_new_node_with_optimizer(new BoolNode(passed_cmp, stride_con > 0 ? BoolTest::lt : BoolTest::gt));
+  range = _igvn.register_new_node_with_optimizer(new CMoveLNode(passed_bol, range, zero, TypeLong::LONG));
+  Node* bound_cmp = _igvn.register_new_node_with_optimizer(new CmpLNode(range, bound));
+  Node* bound_bol = _igvn.register_new_node_with_optimizer(new BoolNode(bound_cmp, stride_con > 0 ? BoolTest::gt : BoolTest::lt));
+  range = _igvn.register_new_node_with_optimizer(new CMoveLNode(bound_bol, range, bound, TypeLong::LONG));
+  Node* zero_cmp = _igvn.register_new_node_with_optimizer(new CmpLNode(range, zero));
+  Node* zero_bol = _igvn.register_new_node_with_optimizer(new BoolNode(zero_cmp, stride_con > 0 ? BoolTest::lt : BoolTest::gt));
+  range = _igvn.register_new_node_with_optimizer(new CMoveLNode(zero_bol, range, zero, TypeLong::LONG));
+  Node* inner_limit = _igvn.register_new_node_with_optimizer(new ConvL2INode(range));
+  const TypeInt* inner_limit_t = stride_con > 0 ? TypeInt::make(0, (jint)iters_limit, Type::WidenMin)
+                                                : TypeInt::make(-(jint)iters_limit, 0, Type::WidenMin);
+  inner_limit = _igvn.register_new_node_with_optimizer(new CastIINode(inner_limit, inner_limit_t));
+
+  // Inner loop: new int induction variable, the long one is rebuilt
+  // from the outer and inner induction variables.
+  Node* inner_phi = new PhiNode(x, TypeInt::INT);
+  Node* inner_incr = new AddINode(inner_phi, _igvn.intcon((jint)stride_con));
+  inner_phi->init_req(LoopNode::EntryControl, _igvn.intcon(0));
+  inner_phi->init_req(LoopNode::LoopBackControl, inner_incr);
+  _igvn.register_new_node_with_optimizer(inner_phi);
+  _igvn.register_new_node_with_optimizer(inner_incr);
+  Node* iv = _igvn.register_new_node_with_optimizer(new ConvI2LNode(inner_phi));
+  iv = _igvn.register_new_node_with_optimizer(new AddLNode(outer_phi, iv));
+  _igvn.replace_node(phi, iv);
+
+  // Inner exit test is evaluated first and falls through to the
+  // original (outer) exit test.
+  Node* inner_cmp = _igvn.register_new_node_with_optimizer(new CmpINode(inner_incr, inner_limit));
+  Node* inner_bol = _igvn.register_new_node_with_optimizer(new BoolNode(inner_cmp, bt));
+  IfNode* inner_iff = new IfNode(iff->in(0), inner_bol, cl_prob, iff->_fcnt);
+  _igvn.register_new_node_with_optimizer(inner_iff);
+  Node* inner_iftrue = _igvn.register_new_node_with_optimizer(new IfTrueNode(inner_iff));
+  Node* inner_iffalse = _igvn.register_new_node_with_optimizer(new IfFalseNode(inner_iff));
+  _igvn.replace_input_of(iff, 0, inner_iffalse);
+  _igvn.replace_input_of(x, LoopNode::EntryControl, outer_head);
+  _igvn.replace_input_of(x, LoopNode::LoopBackControl, inner_iftrue);
+
+#ifndef PRODUCT
+  if (TraceLoopOpts) {
+    tty->print("LongCounted  ");
+    loop->dump_head();
+  }
+#endif
+
+  C->print_method(PHASE_AFTER_CLOOPS, 3);
+  return true;
+}
+
 //----------------------exact_limit-------------------------------------------
 Node* PhaseIdealLoop::exact_limit( IdealLoopTree *loop ) {
   assert(loop->_head->is_CountedLoop(), "");
@@ -3215,6 +3423,23 @@ void PhaseIdealLoop::build_and_optimize() {
   visited.set( C->top()->_idx ); // Set C->top() as visited now
   build_loop_early( visited, worklist, nstack );
 
+  // Transform long indexed loops into a loop nest with an int inner
+  // loop. The inner loop becomes a counted loop on the next round.
+  if (UseLongCountedLoops && _mode == LoopOptsDefault && !_verify_me && !_verify_only) {
+    bool nested = false;
+    for (LoopTreeIterator iter(_ltree_root); !iter.done(); iter.next()) {
+      IdealLoopTree* lpt = iter.current();
+      if (lpt->is_innermost() && !lpt->_head->is_CountedLoop() && is_long_counted_loop(lpt->_head, lpt)) {
+        nested = true;
+      }
+    }
+    if (nested) {
+      _igvn.optimize();
+      C->set_major_progress();
+      return;
+    }
+  }
+
   // Given early legal placement, try finding counted loops.  This placement
   // is good enough to discover most loop invariants.
   if( !_verify_me && !_verify_only SHENANDOAHGC_ONLY(&& !shenandoah_opts))
@@ -1035,6 +1035,7 @@ public:
   virtual Node* transform(Node* n) { return 0; }
 
   bool is_counted_loop(Node* n, IdealLoopTree* &loop);
+  bool is_long_counted_loop(Node* x, IdealLoopTree* loop);
   IdealLoopTree* create_outer_strip_mined_loop(BoolNode *test, Node *cmp, Node *init_control,
                                                IdealLoopTree* loop, float cl_prob, float le_fcnt,
                                                Node*& entry_control, Node*& iffalse);
@@ -534,6 +534,7 @@ class Parse : public GraphKit {
 
   // implementation of object creation bytecodes
   void emit_guard_for_new(ciInstanceKlass* klass);
+  void emit_clinit_barrier(ciInstanceKlass* klass);
   void do_new();
   void do_newarray(BasicType elemtype);
   void do_anewarray();
@@ -90,10 +90,15 @@ void Parse::do_field_access(bool is_get, bool is_field) {
 
   if (!is_field && !field_holder->is_initialized()) {
     if (!static_field_ok_in_clinit(field, method())) {
-      uncommon_trap(Deoptimization::Reason_uninitialized,
-                    Deoptimization::Action_reinterpret,
-                    NULL, "!static_field_ok_in_clinit");
-      return;
+      if (ClassInitBarriers && field_holder->is_being_initialized()) {
+        // Only the initializing thread may pass until <clinit> is done.
+        emit_clinit_barrier(field_holder);
+      } else {
+        uncommon_trap(Deoptimization::Reason_uninitialized,
+                      Deoptimization::Action_reinterpret,
+                      NULL, "!static_field_ok_in_clinit");
+        return;
+      }
     }
   }
 
@@ -285,6 +285,36 @@ void Parse::emit_guard_for_new(ciInstanceKlass* klass) {
                 klass);
 }
 
+void Parse::emit_clinit_barrier(ciInstanceKlass* klass) {
+  // Emit class initialization barrier
+  //   if (klass->_init_state != fully_initialized) {
+  //     if (klass->_init_thread != current_thread ||
+  //         klass->_init_state != being_initialized)
+  //       uncommon_trap
+  //   }
+  // Unlike the guard alone, this keeps working once the initializing
+  // thread is done, so other threads do not deoptimize the code.
+  Node* kls = makecon(TypeKlassPtr::make(klass));
+  Node* init_state_offset = _gvn.MakeConX(in_bytes(InstanceKlass::init_state_offset()));
+  Node* adr_node = basic_plus_adr(kls, kls, init_state_offset);
+  // Use T_BOOLEAN for InstanceKlass::_init_state so the compiler
+  // can generate code to load it as unsigned byte. The fast path must
+  // not see the statics before the state: load it like a volatile field.
+  Node* init_state = make_load(NULL, adr_node, TypeInt::UBYTE, T_BOOLEAN, MemNode::acquire);
+  insert_mem_bar(Op_MemBarAcquire, init_state);
+  Node* fully_init = _gvn.intcon(InstanceKlass::fully_initialized);
+  Node* tst = Bool(CmpI(init_state, fully_init), BoolTest::eq);
+  IfNode* iff = create_and_map_if(control(), tst, PROB_LIKELY_MAG(3), COUNT_UNKNOWN);
+
+  RegionNode* done = new RegionNode(3);
+  record_for_igvn(done);
+  done->init_req(1, IfTrue(iff));
+  set_control(IfFalse(iff));
+  emit_guard_for_new(klass);
+  done->init_req(2, control());
+  set_control(_gvn.transform(done));
+}
+
 
 //------------------------------do_new-----------------------------------------
 void Parse::do_new() {
@@ -305,7 +335,11 @@ void Parse::do_new() {
     return;
   }
   if (klass->is_being_initialized()) {
-    emit_guard_for_new(klass);
+    if (ClassInitBarriers) {
+      emit_clinit_barrier(klass);
+    } else {
+      emit_guard_for_new(klass);
+    }
   }
 
   Node* kls = makecon(TypeKlassPtr::make(klass));
@@ -3894,9 +3894,8 @@ JVM_ENTRY(void, JVM_MarkPreempted(JNIEnv* env, jclass klass, jobject threadObj))
     }
     thr->set_wisp_preempted(true);
   }
-  // fire an thread-local handshake to let the thread go check flag
-  CoroutinePreemptClosure cps;
-  Handshake::execute(&cps, thr);
+  // fire an asynchronous thread-local handshake to let the thread go check flag
+  Handshake::execute_async(new CoroutinePreemptClosure(), thr);
 JVM_END
 
 // Returns an array of java.lang.String objects containing the input arguments to the VM.
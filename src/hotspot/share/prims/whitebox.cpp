@@ -2097,7 +2097,9 @@ WB_END
 class VM_WhiteBoxCleanMetaspaces : public VM_WhiteBoxOperation {
  public:
   void doit() {
-    ClassLoaderDataGraph::do_unloading(true);
+    if (ClassLoaderDataGraph::do_unloading(true)) {
+      ClassLoaderDataGraph::clean_module_and_package_info();
+    }
   }
 };
 
@@ -37,6 +37,7 @@
 #include "logging/logStream.hpp"
 #include "logging/logTag.hpp"
 #include "memory/allocation.inline.hpp"
+#include "memory/metaspaceShared.hpp"
 #include "memory/universe.hpp"
 #include "oops/oop.inline.hpp"
 #include "prims/jvmtiExport.hpp"
@@ -1960,6 +1961,13 @@ void Arguments::set_bytecode_flags() {
   if (!RewriteBytecodes) {
     FLAG_SET_DEFAULT(RewriteFrequentPairs, false);
   }
+  if (RewriteFusedBytecodes) {
+#if !defined(X86) || defined(ZERO)
+    warning("RewriteFusedBytecodes is not supported with current platform"
+            "; ignoring RewriteFusedBytecodes flag.");
+    FLAG_SET_DEFAULT(RewriteFusedBytecodes, false);
+#endif
+  }
 }
 
 // Aggressive optimization flags  -XX:+AggressiveOpts
@@ -3590,6 +3598,26 @@ void Arguments::set_shared_spaces_flags() {
   }
 }
 
+#if INCLUDE_CDS
+// With -XX:ArchiveClassesAtExit=<file> the first run records the classes it
+// loads in <file>.classlist and dumps them into <file> at exit, see
+// MetaspaceShared::archive_classes_at_exit(). Later runs map that archive.
+static void init_archive_classes_at_exit() {
+  struct stat st;
+  if (os::stat(ArchiveClassesAtExit, &st) == 0) {
+    if (FLAG_IS_DEFAULT(SharedArchiveFile)) {
+      FLAG_SET_ERGO(ccstr, SharedArchiveFile, ArchiveClassesAtExit);
+    }
+  } else {
+    MetaspaceShared::record_classes_for_archive_at_exit();
+  }
+  // Same format as the QuickStart tracer, so classes of custom loaders are
+  // recorded and archived too.
+  FLAG_SET_ERGO(bool, DumpAppCDSWithKlassId, true);
+  FLAG_SET_ERGO(bool, AppCDSLegacyVerisonSupport, true);
+}
+#endif
+
 // Sharing support
 // Construct the path to the archive
 static char* get_shared_archive_path() {
@@ -4005,6 +4033,12 @@ jint Arguments::parse(const JavaVMInitArgs* initial_cmd_args) {
     QuickStart::post_process_arguments(cur_cmd_args);
   }
 
+#if INCLUDE_CDS
+  if (ArchiveClassesAtExit != NULL && !DumpSharedSpaces) {
+    init_archive_classes_at_exit();
+  }
+#endif
+
   // Call get_shared_archive_path() here, after possible SharedArchiveFile option got parsed.
   SharedArchivePath = get_shared_archive_path();
   if (SharedArchivePath == NULL) {
@@ -35,6 +35,8 @@
 #include "runtime/biasedLocking.hpp"
 #include "runtime/handles.inline.hpp"
 #include "runtime/handshake.hpp"
+#include "runtime/mutexLocker.hpp"
+#include "runtime/os.hpp"
 #include "runtime/task.hpp"
 #include "runtime/threadSMR.hpp"
 #include "runtime/vframe.hpp"
@@ -116,6 +118,23 @@ bool BiasedLocking::enabled() {
   return _biased_locking_enabled;
 }
 
+// Revocation statistics
+static volatile jlong _self_revocations      = 0;
+static volatile jlong _handshake_revocations = 0;
+static volatile jlong _safepoint_revocations = 0;
+static volatile jlong _bulk_rebiases         = 0;
+static volatile jlong _bulk_revocations      = 0;
+static volatile jlong _handshake_nanos       = 0;  // time threads waited for handshake revocations
+static volatile jlong _safepoint_nanos       = 0;  // time threads waited for revocations at safepoints
+
+jlong BiasedLocking::self_revocations()      { return _self_revocations; }
+jlong BiasedLocking::handshake_revocations() { return _handshake_revocations; }
+jlong BiasedLocking::safepoint_revocations() { return _safepoint_revocations; }
+jlong BiasedLocking::bulk_rebiases()         { return _bulk_rebiases; }
+jlong BiasedLocking::bulk_revocations()      { return _bulk_revocations; }
+jlong BiasedLocking::handshake_nanos()       { return _handshake_nanos; }
+jlong BiasedLocking::safepoint_nanos()       { return _safepoint_nanos; }
+
 // Returns MonitorInfos for all objects locked on this thread in youngest to oldest order
 static GrowableArray<MonitorInfo*>* get_or_compute_monitor_info(JavaThread* thread) {
   GrowableArray<MonitorInfo*>* info = thread->cached_monitor_info();
@@ -351,6 +370,7 @@ static HeuristicsResult update_heuristics(oop o, bool allow_rebias) {
     // many more revocation operations in a short period of time we
     // will completely disable biasing for this type.
     k->set_biased_lock_revocation_count(0);
+    k->set_biased_lock_revocation_cost(0);
     revocation_count = 0;
   }
 
@@ -367,6 +387,16 @@ static HeuristicsResult update_heuristics(oop o, bool allow_rebias) {
     return HR_BULK_REBIAS;
   }
 
+  if (BiasedLockingBulkRebiasCost > 0 &&
+      revocation_count < BiasedLockingBulkRebiasThreshold &&
+      k->biased_lock_revocation_cost() >= BiasedLockingBulkRebiasCost) {
+    // Revoking the biases of this type one at a time already took longer
+    // than a bulk rebias is expected to, so skip ahead to it. Later
+    // revocations count on towards the bulk revocation as usual.
+    k->set_biased_lock_revocation_count(BiasedLockingBulkRebiasThreshold);
+    return HR_BULK_REBIAS;
+  }
+
   return HR_SINGLE_REVOKE;
 }
 
@@ -386,6 +416,12 @@ static BiasedLocking::Condition bulk_revoke_or_rebias_at_safepoint(oop o,
 
   jlong cur_time = os::javaTimeMillis();
   o->klass()->set_last_biased_lock_bulk_revocation_time(cur_time);
+  o->klass()->set_biased_lock_revocation_cost(0);
+  if (bulk_rebias) {
+    _bulk_rebiases++;
+  } else {
+    _bulk_revocations++;
+  }
 
 
   Klass* k_o = o->klass();
@@ -585,6 +621,83 @@ public:
   }
 };
 
+// Revokes the bias of a single object in a handshake with the thread
+// the object is biased toward. That thread cannot lock or unlock the
+// object while it is stopped, and no other thread may change the mark
+// word of an object biased toward a live thread in the current epoch.
+class RevokeOneBias : public HandshakeClosure {
+  Handle _obj;
+  JavaThread* _requesting_thread;
+  JavaThread* _biased_locker;
+  BiasedLocking::Condition _status_code;
+  traceid _biased_locker_id;
+
+ public:
+  RevokeOneBias(Handle obj, JavaThread* requesting_thread, JavaThread* biased_locker)
+    : HandshakeClosure("RevokeOneBias")
+    , _obj(obj)
+    , _requesting_thread(requesting_thread)
+    , _biased_locker(biased_locker)
+    , _status_code(BiasedLocking::NOT_BIASED)
+    , _biased_locker_id(0) {}
+
+  void do_thread(Thread* target) {
+    assert(target == _biased_locker, "Wrong thread");
+
+    oop o = _obj();
+    markOop mark = o->mark();
+    if (!mark->has_bias_pattern()) {
+      return;
+    }
+
+    markOop prototype = o->klass()->prototype_header();
+    if (!prototype->has_bias_pattern()) {
+      // This object has a stale bias from before the bulk revocation
+      // of its type. If we fail this race, another thread has revoked
+      // the bias already.
+      markOop biased_value = mark;
+      mark = o->cas_set_mark(markOopDesc::prototype()->set_age(mark->age()), mark);
+      assert(!o->mark()->has_bias_pattern(), "even if we raced, should still be revoked");
+      if (biased_value == mark) {
+        _status_code = BiasedLocking::BIAS_REVOKED;
+      }
+      return;
+    }
+
+    if (_biased_locker == mark->biased_locker()) {
+      if (mark->bias_epoch() == prototype->bias_epoch()) {
+        // The epoch is still valid, so the biased locker may currently
+        // hold the lock. Walk its stack and turn the lock records of
+        // this object into stack locks.
+        ResourceMark rm;
+        log_info(biasedlocking, handshake)("Revoking bias in handshake with thread " INTPTR_FORMAT,
+                                           p2i(_biased_locker));
+        _status_code = revoke_bias(o, false, false, _requesting_thread, NULL);
+        _biased_locker->set_cached_monitor_info(NULL);
+        assert(!o->mark()->has_bias_pattern(), "invariant");
+        _biased_locker_id = JFR_THREAD_ID(_biased_locker);
+        return;
+      } else {
+        // The epoch expired, another thread may be rebiasing the object
+        // with a CAS at the same time.
+        markOop biased_value = mark;
+        mark = o->cas_set_mark(markOopDesc::prototype()->set_age(mark->age()), mark);
+        if (mark == biased_value || !mark->has_bias_pattern()) {
+          assert(!o->mark()->has_bias_pattern(), "should be revoked");
+          _status_code = (biased_value == mark) ? BiasedLocking::BIAS_REVOKED : BiasedLocking::NOT_BIASED;
+          return;
+        }
+      }
+    }
+
+    // The object is biased toward another thread by now
+    _status_code = BiasedLocking::NOT_REVOKED;
+  }
+
+  BiasedLocking::Condition status_code() const { return _status_code; }
+  traceid biased_locker() const { return _biased_locker_id; }
+};
+
 template <typename E>
 static void set_safepoint_id(E* event) {
   assert(event != NULL, "invariant");
@@ -600,17 +713,71 @@ static void post_self_revocation_event(EventBiasedLockSelfRevocation* event, Kla
   event->commit();
 }
 
-static void post_revocation_event(EventBiasedLockRevocation* event, Klass* k, VM_RevokeBias* revoke) {
+static void post_revocation_event(EventBiasedLockRevocation* event, Klass* k, RevokeOneBias* revoke) {
   assert(event != NULL, "invariant");
   assert(k != NULL, "invariant");
   assert(revoke != NULL, "invariant");
   assert(event->should_commit(), "invariant");
   event->set_lockClass(k);
-  set_safepoint_id(event);
+  // No safepoint is involved in revoking the bias of a single object
+  event->set_safepointId(0);
   event->set_previousOwner(revoke->biased_locker());
   event->commit();
 }
 
+static BiasedLocking::Condition single_revoke_with_handshake(Handle obj, JavaThread* requester, JavaThread* biaser) {
+  EventBiasedLockRevocation event;
+  if (log_is_enabled(Info, biasedlocking, handshake)) {
+    ResourceMark rm;
+    log_info(biasedlocking, handshake)("JavaThread " INTPTR_FORMAT " handshaking JavaThread "
+                                       INTPTR_FORMAT " to revoke object " INTPTR_FORMAT,
+                                       p2i(requester), p2i(biaser), p2i(obj()));
+  }
+
+  RevokeOneBias revoke(obj, requester, biaser);
+  jlong start = os::javaTimeNanos();
+  bool executed = Handshake::execute(&revoke, biaser);
+  jlong elapsed = os::javaTimeNanos() - start;
+  Atomic::add(elapsed, &_handshake_nanos);
+  obj->klass()->atomic_add_biased_lock_revocation_cost((int)MIN2(elapsed / 1000, (jlong)max_jint));
+
+  if (revoke.status_code() == BiasedLocking::NOT_REVOKED) {
+    return BiasedLocking::NOT_REVOKED;
+  }
+  if (executed) {
+    if (revoke.status_code() == BiasedLocking::BIAS_REVOKED) {
+      Atomic::inc(&_handshake_revocations);
+      if (event.should_commit()) {
+        post_revocation_event(&event, obj->klass(), &revoke);
+      }
+    }
+    assert(!obj->mark()->has_bias_pattern(), "invariant");
+    return revoke.status_code();
+  }
+
+  // The biased locker is not alive anymore. Hold the Threads_lock while
+  // revoking, so that a new thread that happens to get the same address
+  // cannot start to lock the object in the meantime.
+  MutexLocker ml(Threads_lock);
+  markOop mark = obj->mark();
+  if (!mark->has_bias_pattern()) {
+    return BiasedLocking::NOT_BIASED;
+  }
+  ThreadsListHandle tlh;
+  markOop prototype = obj->klass()->prototype_header();
+  if (!prototype->has_bias_pattern() || (!tlh.includes(biaser) && biaser == mark->biased_locker() &&
+                                         prototype->bias_epoch() == mark->bias_epoch())) {
+    obj->cas_set_mark(markOopDesc::prototype()->set_age(mark->age()), mark);
+    assert(!obj->mark()->has_bias_pattern(), "bias should be revoked by now");
+    Atomic::inc(&_handshake_revocations);
+    if (event.should_commit()) {
+      post_revocation_event(&event, obj->klass(), &revoke);
+    }
+    return BiasedLocking::BIAS_REVOKED;
+  }
+  return BiasedLocking::NOT_REVOKED;
+}
+
 static void post_class_revocation_event(EventBiasedLockClassRevocation* event, Klass* k, bool disabled_bias) {
   assert(event != NULL, "invariant");
   assert(k != NULL, "invariant");
@@ -706,18 +873,28 @@ BiasedLocking::Condition BiasedLocking::revoke_and_rebias(Handle obj, bool attem
       BiasedLocking::Condition cond = revoke_bias(obj(), false, false, (JavaThread*) THREAD, NULL);
       ((JavaThread*) THREAD)->set_cached_monitor_info(NULL);
       assert(cond == BIAS_REVOKED, "why not?");
+      Atomic::inc(&_self_revocations);
       if (event.should_commit()) {
         post_self_revocation_event(&event, k);
       }
       return cond;
     } else {
-      EventBiasedLockRevocation event;
-      VM_RevokeBias revoke(&obj, (JavaThread*) THREAD);
-      VMThread::execute(&revoke);
-      if (event.should_commit() && revoke.status_code() != NOT_BIASED) {
-        post_revocation_event(&event, k, &revoke);
+      JavaThread* biaser = mark->biased_locker();
+      if (biaser == NULL) {
+        // Anonymously biased, nobody can hold the lock
+        markOop unbiased_prototype = markOopDesc::prototype()->set_age(mark->age());
+        if (obj->cas_set_mark(unbiased_prototype, mark) == mark) {
+          return BIAS_REVOKED;
+        }
+      } else {
+        Condition cond = single_revoke_with_handshake(obj, (JavaThread*) THREAD, biaser);
+        if (cond != NOT_REVOKED) {
+          return cond;
+        }
       }
-      return revoke.status_code();
+      // The mark word changed while we tried to revoke the bias, start
+      // over with the new one
+      return revoke_and_rebias(obj, attempt_rebias, THREAD);
     }
   }
 
@@ -727,7 +904,9 @@ BiasedLocking::Condition BiasedLocking::revoke_and_rebias(Handle obj, bool attem
   VM_BulkRevokeBias bulk_revoke(&obj, (JavaThread*) THREAD,
                                 (heuristics == HR_BULK_REBIAS),
                                 attempt_rebias);
+  jlong start = os::javaTimeNanos();
   VMThread::execute(&bulk_revoke);
+  Atomic::add(os::javaTimeNanos() - start, &_safepoint_nanos);
   if (event.should_commit()) {
     post_class_revocation_event(&event, obj->klass(), heuristics != HR_BULK_REBIAS);
   }
@@ -741,7 +920,9 @@ void BiasedLocking::revoke(GrowableArray<Handle>* objs) {
     return;
   }
   VM_RevokeBias revoke(objs, JavaThread::current());
+  jlong start = os::javaTimeNanos();
   VMThread::execute(&revoke);
+  Atomic::add(os::javaTimeNanos() - start, &_safepoint_nanos);
 }
 
 
@@ -751,6 +932,7 @@ void BiasedLocking::revoke_at_safepoint(Handle h_obj) {
   HeuristicsResult heuristics = update_heuristics(obj, false);
   if (heuristics == HR_SINGLE_REVOKE) {
     revoke_bias(obj, false, false, NULL, NULL);
+    _safepoint_revocations++;
   } else if ((heuristics == HR_BULK_REBIAS) ||
              (heuristics == HR_BULK_REVOKE)) {
     bulk_revoke_or_rebias_at_safepoint(obj, (heuristics == HR_BULK_REBIAS), false, NULL);
@@ -767,6 +949,7 @@ void BiasedLocking::revoke_at_safepoint(GrowableArray<Handle>* objs) {
     HeuristicsResult heuristics = update_heuristics(obj, false);
     if (heuristics == HR_SINGLE_REVOKE) {
       revoke_bias(obj, false, false, NULL, NULL);
+      _safepoint_revocations++;
     } else if ((heuristics == HR_BULK_REBIAS) ||
                (heuristics == HR_BULK_REVOKE)) {
       bulk_revoke_or_rebias_at_safepoint(obj, (heuristics == HR_BULK_REBIAS), false, NULL);
@@ -76,15 +76,15 @@
 // Revocation of the lock's bias is fairly straightforward. We want to
 // restore the object's header and stack-based BasicObjectLocks and
 // BasicLocks to the state they would have been in had the object been
-// locked by HotSpot's usual fast locking scheme. To do this, we bring
-// the system to a safepoint and walk the stack of the thread toward
-// which the lock is biased. We find all of the lock records on the
+// locked by HotSpot's usual fast locking scheme. To do this, we
+// handshake with the thread toward which the lock is biased and walk
+// its stack while it is stopped. We find all of the lock records on the
 // stack corresponding to this object, in particular the first /
 // "highest" record. We fill in the highest lock record with the
 // object's displaced header (which is a well-known value given that
 // we don't maintain an identity hash nor age bits for the object
 // while it's in the biased state) and all other lock records with 0,
-// the value for recursive locks. When the safepoint is released, the
+// the value for recursive locks. When the handshake is completed, the
 // formerly-biased thread and all other threads revert back to
 // HotSpot's CAS-based locking.
 //
@@ -161,7 +161,8 @@ public:
   enum Condition {
     NOT_BIASED = 1,
     BIAS_REVOKED = 2,
-    BIAS_REVOKED_AND_REBIASED = 3
+    BIAS_REVOKED_AND_REBIASED = 3,
+    NOT_REVOKED = 4      // the bias changed during a handshake, only used internally
   };
 
   // This initialization routine should only be called once and
@@ -182,6 +183,15 @@ public:
   static void revoke_at_safepoint(Handle obj);
   static void revoke_at_safepoint(GrowableArray<Handle>* objs);
 
+  // Revocation statistics, reported by the BiasedLockingStatistics event
+  static jlong self_revocations();
+  static jlong handshake_revocations();
+  static jlong safepoint_revocations();
+  static jlong bulk_rebiases();
+  static jlong bulk_revocations();
+  static jlong handshake_nanos();
+  static jlong safepoint_nanos();
+
   static void print_counters() { _counters.print(); }
   static BiasedLockingCounters* counters() { return &_counters; }
 
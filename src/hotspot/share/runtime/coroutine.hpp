@@ -657,9 +657,9 @@ private:
   JavaThread*   _thread;
 };
 
-class CoroutinePreemptClosure : public HandshakeClosure{
+class CoroutinePreemptClosure : public AsyncHandshakeClosure {
 public:
-  CoroutinePreemptClosure():HandshakeClosure("CoroutinePreempt") {}
+  CoroutinePreemptClosure():AsyncHandshakeClosure("CoroutinePreempt") {}
 
   void do_thread(Thread* thread) {
   // do nothing
@@ -943,7 +943,7 @@ define_pd_global(uint64_t,MaxRAM,                    1ULL*G);
   product(bool, CompactFields, true,                                        \
           "Allocate nonstatic fields in gaps between previous fields")      \
                                                                             \
-  notproduct(bool, PrintFieldLayout, false,                                 \
+  diagnostic(bool, PrintFieldLayout, false,                                 \
           "Print field layout for each class")                              \
                                                                             \
   /* Need to limit the extent of the padding to reasonable size.          */\
@@ -87,6 +87,121 @@
   product(bool, AppCDSVerifyClassPathOrder, true,                           \
           "Verify classpath order between the dump phase and replay phase") \
                                                                             \
+  product(uintx, HotCodeHeapSize, 0,                                        \
+          "Size of the code heap for C2-compiled hot methods (in bytes), "  \
+          "taken from the non-profiled code heap. 0 disables it")           \
+                                                                            \
+  product(intx, HotCodeMinInvocations, 100000,                              \
+          "Minimum invocation plus backedge count of a method for its C2 "  \
+          "code to be placed in the hot code heap")                         \
+                                                                            \
+  product(bool, HotCodeRelocation, false,                                   \
+          "Make C2-compiled methods that got hot outside of the hot code "  \
+          "heap not entrant, so they are recompiled into it")               \
+                                                                            \
+  product(bool, SweeperUseHandshakes, false,                                \
+          "Let the sweeper scan thread stacks for active nmethods with a "  \
+          "handshake instead of during safepoint cleanup")                  \
+                                                                            \
+  product(bool, CodeCacheDefragmentation, false,                            \
+          "Let the sweeper make nmethods that split the free space of a "   \
+          "fragmented code heap not entrant, so that they are flushed and " \
+          "recompiled into contiguous space")                               \
+                                                                            \
+  product(uintx, CodeCacheDefragmentationThreshold, 50,                     \
+          "Percentage of the free space of a code heap outside of its "     \
+          "largest free block above which the heap is defragmented")        \
+                                                                            \
+  product(ccstr, ReplayCaptureFile, NULL,                                   \
+          "Capture the compiler replay data of every compilation into "     \
+          "this file, see Compiler.replay_capture")                         \
+                                                                            \
+  product(bool, AsyncDeflateIdleMonitors, false,                            \
+          "Deflate idle monitors in the service thread with handshakes "    \
+          "instead of during safepoint cleanup. Requires "                  \
+          "MonitorInUseLists")                                              \
+                                                                            \
+  product(intx, AsyncDeflationInterval, 250,                                \
+          "Interval in ms between checks of the service thread whether "    \
+          "idle monitors should be deflated asynchronously")                \
+                                                                            \
+  product(bool, UseAdaptiveMonitorSpinning, false,                          \
+          "Keep per-monitor hold time and spin success statistics and use " \
+          "them to choose between spinning, yielding and parking on a "     \
+          "contended monitor, see Thread.contended_monitors")               \
+                                                                            \
+  product(intx, AdaptiveSpinParkHoldNanos, 50000,                           \
+          "Park right away on a monitor whose average hold time is above "  \
+          "this many nanoseconds")                                          \
+                                                                            \
+  product(intx, AdaptiveSpinYieldSuccessPercent, 20,                        \
+          "Yield once instead of spinning on a monitor whose spin success " \
+          "rate is below this percentage")                                  \
+                                                                            \
+  product(intx, TimeToSafepointTopThreads, 0,                               \
+          "Record when each thread reaches a safepoint and report this "    \
+          "many of the slowest threads per safepoint under safepoint+stats "\
+          "logging and as SafepointSlowThread JFR events. 0 disables it")   \
+                                                                            \
+  product(bool, TimeToSafepointCodeAttribution, false,                      \
+          "Look up the compiled code the slowest threads reached a "        \
+          "safepoint in, to tell loop polls from method return polls")      \
+                                                                            \
+  product(intx, BytecodeSamplingInterval, 0,                                \
+          "Interval in ms at which a sampler thread records the bytecodes " \
+          "interpreted threads execute, see Interpreter.bytecode_samples. " \
+          "0 disables it")                                                  \
+          range(0, max_jint)                                                \
+                                                                            \
+  product(bool, RewriteFusedBytecodes, false,                               \
+          "Rewrite iload, iload, if_icmp<cond> sequences at link time "     \
+          "into a single bytecode the interpreter executes without "        \
+          "dispatching in between. Requires RewriteFrequentPairs")          \
+                                                                            \
+  product(intx, BiasedLockingBulkRebiasCost, 0,                             \
+          "Time in microseconds threads of a type may wait for the "        \
+          "revocation of single biases before its objects are bulk "        \
+          "rebiased, regardless of BiasedLockingBulkRebiasThreshold. "      \
+          "0 disables it")                                                  \
+                                                                            \
+  manageable(bool, SymbolTableStatistics, false,                            \
+          "Measure the latency of symbol table lookups and inserts, "       \
+          "reported by VM.symboltable")                                     \
+                                                                            \
+  product(uintx, ClassListPrefetchThreads, 0,                               \
+          "Number of threads that read the class files of the class list "  \
+          "entries with a source: jar ahead of their parsing when dumping " \
+          "the archive. 0 disables it")                                     \
+          range(0, 256)                                                     \
+                                                                            \
+  product(bool, UseVerificationCache, false,                                \
+          "Skip verifying classes that were verified in an earlier run "    \
+          "with the same class files and assignability check results")      \
+                                                                            \
+  product(ccstr, VerificationCacheFile, NULL,                               \
+          "File of the verification cache, by default verification.cache "  \
+          "in the QuickStart cache directory")                              \
+                                                                            \
+  product(bool, MetaspaceUncommitFreeChunks, false,                         \
+          "Return the memory of free metaspace chunks to the operating "    \
+          "system when metaspace is purged after class unloading")          \
+                                                                            \
+  product(bool, CompactFieldsInSuperGaps, false,                            \
+          "Allocate nonstatic fields in gaps left in the field layout of "  \
+          "the superclasses")                                               \
+                                                                            \
+  product(bool, ClassInitBarriers, false,                                   \
+          "Check the initialization state of classes being initialized "    \
+          "in compiled code instead of deoptimizing it")                    \
+                                                                            \
+  product(bool, LockFreeIndyResolution, false,                              \
+          "Publish resolved invokedynamic call sites with a CAS instead "   \
+          "of locking the resolved references of the class")                \
+                                                                            \
+  product(ccstr, ArchiveClassesAtExit, NULL,                                \
+          "Record the classes loaded by this run and dump them into the "   \
+          "CDS archive <file> at exit; later runs map the archive")         \
+                                                                            \
   //add new AJDK specific flags here
 
 
@@ -26,10 +26,12 @@
 #include "logging/log.hpp"
 #include "logging/logStream.hpp"
 #include "memory/resourceArea.hpp"
+#include "runtime/atomic.hpp"
 #include "runtime/handshake.hpp"
 #include "runtime/interfaceSupport.inline.hpp"
 #include "runtime/orderAccess.hpp"
 #include "runtime/osThread.hpp"
+#include "runtime/safepoint.hpp"
 #include "runtime/semaphore.inline.hpp"
 #include "runtime/task.hpp"
 #include "runtime/thread.hpp"
@@ -402,7 +404,35 @@ bool Handshake::execute(HandshakeClosure* thread_cl, JavaThread* target) {
   }
 }
 
-HandshakeState::HandshakeState() : _operation(NULL), _semaphore(1), _thread_in_process_handshake(false) {}
+void Handshake::execute_async(AsyncHandshakeClosure* thread_cl, JavaThread* target) {
+  if (!ThreadLocalHandshakes) {
+    // Without thread-local polls there is nothing to queue the operation
+    // on, so execute it synchronously instead.
+    VM_HandshakeFallbackOperation op(thread_cl, target);
+    VMThread::execute(&op);
+    delete thread_cl;
+    return;
+  }
+  ThreadsListHandle tlh;
+  if (tlh.includes(target)) {
+    target->queue_async_handshake(thread_cl);
+  } else {
+    log_trace(handshake)("Asynchronous operation %s dropped, thread dead", thread_cl->name());
+    delete thread_cl;
+  }
+}
+
+HandshakeState::HandshakeState() : _operation(NULL), _async_queue(NULL), _semaphore(1), _thread_in_process_handshake(false) {}
+
+HandshakeState::~HandshakeState() {
+  // The thread exited before it polled, drop what is still queued
+  AsyncHandshakeClosure* cl = _async_queue;
+  while (cl != NULL) {
+    AsyncHandshakeClosure* next = cl->_next;
+    delete cl;
+    cl = next;
+  }
+}
 
 void HandshakeState::set_operation(JavaThread* target, HandshakeOperation* op) {
   _operation = op;
@@ -412,6 +442,60 @@ void HandshakeState::set_operation(JavaThread* target, HandshakeOperation* op) {
 void HandshakeState::clear_handshake(JavaThread* target) {
   _operation = NULL;
   SafepointMechanism::disarm_local_poll_release(target);
+  // The VM thread may clear the operation of a blocked thread: asynchronous
+  // operations still queued need the poll to get executed. One queued after
+  // the check arms the poll itself.
+  OrderAccess::fence();
+  if (_async_queue != NULL) {
+    SafepointMechanism::arm_local_poll_release(target);
+  }
+}
+
+void HandshakeState::add_async_operation(JavaThread* target, AsyncHandshakeClosure* cl) {
+  AsyncHandshakeClosure* head;
+  do {
+    head = _async_queue;
+    cl->_next = head;
+  } while (Atomic::cmpxchg(cl, &_async_queue, head) != head);
+  SafepointMechanism::arm_local_poll_release(target);
+}
+
+void HandshakeState::process_async_operations(JavaThread* thread) {
+  if (_async_queue == NULL) {
+    return;
+  }
+  // Disarm before taking the queue, an operation queued after that arms
+  // the poll again. A synchronous operation set meanwhile must not lose
+  // its poll either. Unlike those, asynchronous operations do not run in a
+  // VM operation, so a safepoint may be synchronizing right now and have
+  // armed the poll too. Re-arm for it, or the thread would return to Java
+  // without blocking and the safepoint would never be reached.
+  SafepointMechanism::disarm_local_poll_release(thread);
+  OrderAccess::fence();
+  AsyncHandshakeClosure* list = Atomic::xchg((AsyncHandshakeClosure*)NULL, &_async_queue);
+  if (has_sync_operation() ||
+      SafepointSynchronize::is_synchronizing() || SafepointSynchronize::is_at_safepoint()) {
+    SafepointMechanism::arm_local_poll_release(thread);
+  }
+
+  // Execute the whole batch in the order it was queued
+  AsyncHandshakeClosure* fifo = NULL;
+  while (list != NULL) {
+    AsyncHandshakeClosure* next = list->_next;
+    list->_next = fifo;
+    fifo = list;
+    list = next;
+  }
+  int executed = 0;
+  while (fifo != NULL) {
+    AsyncHandshakeClosure* cl = fifo;
+    fifo = cl->_next;
+    log_trace(handshake, task)("Asynchronous operation: %s for thread " PTR_FORMAT, cl->name(), p2i(thread));
+    cl->do_thread(thread);
+    delete cl;
+    executed++;
+  }
+  log_debug(handshake)("Thread " PTR_FORMAT " executed %d asynchronous handshake operation(s)", p2i(thread), executed);
 }
 
 void HandshakeState::process_self_inner(JavaThread* thread) {
@@ -423,12 +507,15 @@ void HandshakeState::process_self_inner(JavaThread* thread) {
     _semaphore.wait_with_safepoint_check(thread);
   }
   HandshakeOperation* op = OrderAccess::load_acquire(&_operation);
-  if (op != NULL) {
+  if (op != NULL || _async_queue != NULL) {
     HandleMark hm(thread);
     CautiouslyPreserveExceptionMark pem(thread);
-    // Disarm before execute the operation
-    clear_handshake(thread);
-    op->do_handshake(thread);
+    if (op != NULL) {
+      // Disarm before execute the operation
+      clear_handshake(thread);
+      op->do_handshake(thread);
+    }
+    process_async_operations(thread);
   }
   _semaphore.signal();
 }
@@ -471,7 +558,7 @@ bool HandshakeState::claim_handshake_for_vmthread() {
   if (!_semaphore.trywait()) {
     return false;
   }
-  if (has_operation()) {
+  if (has_sync_operation()) {
     return true;
   }
   _semaphore.signal();
@@ -483,7 +570,7 @@ HandshakeState::ProcessResult HandshakeState::try_process_by_vmThread(JavaThread
   // Threads_lock must be held here, but that is assert()ed in
   // possibly_vmthread_can_process_handshake().
 
-  if (!has_operation()) {
+  if (!has_sync_operation()) {
     // JT has already cleared its handshake
     return _no_operation;
   }
@@ -47,11 +47,29 @@ class HandshakeClosure : public ThreadClosure {
   virtual void do_thread(Thread* thread) = 0;
 };
 
+// An asynchronous handshake closure is allocated on the C heap and queued
+// on its target thread without waiting for it to be executed. Only the
+// target executes it, at its next poll, together with all the other
+// asynchronous operations queued by then, and deletes it afterwards. The
+// closure is deleted without being executed if the target exits first.
+class AsyncHandshakeClosure : public HandshakeClosure {
+  friend class HandshakeState;
+  AsyncHandshakeClosure* _next;
+ public:
+  AsyncHandshakeClosure(const char* name) : HandshakeClosure(name), _next(NULL) {}
+  virtual ~AsyncHandshakeClosure() {}
+
+  void* operator new(size_t size) throw() { return AllocateHeap(size, mtThread); }
+  void  operator delete(void* p)          { FreeHeap(p); }
+};
+
 class Handshake : public AllStatic {
  public:
   // Execution of handshake operation
   static void execute(HandshakeClosure* hs_cl);
   static bool execute(HandshakeClosure* hs_cl, JavaThread* target);
+  // Queues the operation on the target and returns without waiting
+  static void execute_async(AsyncHandshakeClosure* hs_cl, JavaThread* target);
 };
 
 class HandshakeOperation;
@@ -62,6 +80,8 @@ class HandshakeOperation;
 // or the JavaThread itself.
 class HandshakeState {
   HandshakeOperation* volatile _operation;
+  // Asynchronous operations, most recently queued first
+  AsyncHandshakeClosure* volatile _async_queue;
 
   Semaphore _semaphore;
   bool _thread_in_process_handshake;
@@ -72,12 +92,19 @@ class HandshakeState {
   void clear_handshake(JavaThread* thread);
 
   void process_self_inner(JavaThread* thread);
+  void process_async_operations(JavaThread* thread);
 public:
   HandshakeState();
+  ~HandshakeState();
 
   void set_operation(JavaThread* thread, HandshakeOperation* op);
+  void add_async_operation(JavaThread* thread, AsyncHandshakeClosure* cl);
 
   bool has_operation() const {
+    return _operation != NULL || _async_queue != NULL;
+  }
+
+  bool has_sync_operation() const {
     return _operation != NULL;
   }
 
@@ -28,10 +28,12 @@
 #include "classfile/classLoader.hpp"
 #include "classfile/stringTable.hpp"
 #include "classfile/systemDictionary.hpp"
+#include "classfile/verificationCache.hpp"
 #include "code/codeCache.hpp"
 #include "compiler/compileBroker.hpp"
 #include "compiler/compilerOracle.hpp"
 #include "interpreter/bytecodeHistogram.hpp"
+#include "interpreter/bytecodeSampler.hpp"
 #include "jfr/jfrEvents.hpp"
 #include "jfr/support/jfrThreadId.hpp"
 #if INCLUDE_JVMCI
@@ -41,6 +43,7 @@
 #include "logging/log.hpp"
 #include "logging/logStream.hpp"
 #include "memory/oopFactory.hpp"
+#include "memory/metaspaceShared.hpp"
 #include "memory/resourceArea.hpp"
 #include "memory/universe.hpp"
 #include "oops/constantPool.hpp"
@@ -508,6 +511,9 @@ void before_exit(JavaThread* thread) {
   StatSampler::disengage();
   StatSampler::destroy();
 
+  // Stop the bytecode sampler thread
+  BytecodeSampler::disengage();
+
   // Stop concurrent GC threads
   Universe::heap()->stop();
 
@@ -527,6 +533,16 @@ void before_exit(JavaThread* thread) {
     BytecodeHistogram::print();
   }
 
+  if (UseVerificationCache) {
+    VerificationCache::write();
+  }
+
+#if INCLUDE_CDS
+  if (ArchiveClassesAtExit != NULL) {
+    MetaspaceShared::archive_classes_at_exit(thread);
+  }
+#endif
+
 #ifdef LINUX
   if (DumpPerfMapAtExit) {
     CodeCache::write_perf_map();
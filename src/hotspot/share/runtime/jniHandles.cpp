@@ -391,6 +391,18 @@ JNIHandleBlock* JNIHandleBlock::allocate_block(Thread* thread)  {
       // Get block from free list
       block = _block_free_list;
       _block_free_list = _block_free_list->_next;
+      if (thread != NULL && _block_free_list != NULL) {
+        // Move a batch of blocks to the thread-local free list, so that
+        // the following allocations don't take the lock.
+        JNIHandleBlock* first = _block_free_list;
+        JNIHandleBlock* last = first;
+        for (int i = 1; i < block_refill_batch && last->_next != NULL; i++) {
+          last = last->_next;
+        }
+        _block_free_list = last->_next;
+        last->_next = NULL;
+        thread->set_free_handle_block(first);
+      }
     }
   }
   block->_top = 0;
@@ -427,19 +439,20 @@ void JNIHandleBlock::release_block(JNIHandleBlock* block, Thread* thread) {
   }
   if (block != NULL) {
     // Return blocks to free list
+    JNIHandleBlock* last = block;
+    last->zap();
+    while (last->_next != NULL) {
+      last = last->_next;
+      last->zap();
+    }
     // locking with safepoint checking introduces a potential deadlock:
     // - we would hold JNIHandleBlockFreeList_lock and then Threads_lock
     // - another would hold Threads_lock (jni_AttachCurrentThread) and then
     //   JNIHandleBlockFreeList_lock (JNIHandleBlock::allocate_block)
     MutexLockerEx ml(JNIHandleBlockFreeList_lock,
                      Mutex::_no_safepoint_check_flag);
-    while (block != NULL) {
-      block->zap();
-      JNIHandleBlock* next = block->_next;
-      block->_next = _block_free_list;
-      _block_free_list = block;
-      block = next;
-    }
+    last->_next = _block_free_list;
+    _block_free_list = block;
   }
   if (pop_frame_link != NULL) {
     // As a sanity check we release blocks pointed to by the pop_frame_link.
@@ -135,7 +135,8 @@ class JNIHandleBlock : public CHeapObj<mtInternal> {
 
  private:
   enum SomeConstants {
-    block_size_in_oops  = 32                    // Number of handles per handle block
+    block_size_in_oops  = 32,                   // Number of handles per handle block
+    block_refill_batch  = 8                     // Number of blocks moved to a thread's free list at once
   };
 
   oop             _handles[block_size_in_oops]; // The handles
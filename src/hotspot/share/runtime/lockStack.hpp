@@ -82,6 +82,9 @@ public:
   // Pops an oop from this lock-stack.
   inline oop pop();
 
+  // Returns the least recently pushed oop of this lock-stack.
+  inline oop bottom() const;
+
   // Removes an oop from an arbitrary location of this lock-stack.
   inline void remove(oop o);
 
@@ -75,6 +75,11 @@ inline oop LockStack::pop() {
   return o;
 }
 
+inline oop LockStack::bottom() const {
+  assert(to_index(_top) > 0, "no bottom without entries");
+  return _base[0];
+}
+
 inline void LockStack::remove(oop o) {
   verify("pre-remove");
   assert(contains(o), "entry must be present: " PTR_FORMAT, p2i(o));
@@ -263,7 +263,7 @@ void ObjectMonitor::operator delete[] (void *p) {
 // -----------------------------------------------------------------------------
 // Enter support
 
-void ObjectMonitor::enter(TRAPS) {
+bool ObjectMonitor::enter(TRAPS) {
   // The following code is ordered to check the most common cases first
   // and to reduce RTS->RTO cache line upgrades on SPARC and IA32 processors.
   if (UseWispMonitor) {
@@ -276,13 +276,13 @@ void ObjectMonitor::enter(TRAPS) {
     // Either ASSERT _recursions == 0 or explicitly set _recursions = 0.
     assert(_recursions == 0, "invariant");
     assert(_owner == Self, "invariant");
-    return;
+    return true;
   }
 
   if (cur == Self) {
     // TODO-FIXME: check for integer overflow!  BUGID 6557169.
     _recursions++;
-    return;
+    return true;
   }
 
   if (!UseAltFastLocking && Self->is_lock_owned ((address)cur)) {
@@ -291,13 +291,16 @@ void ObjectMonitor::enter(TRAPS) {
     // Commute owner from a thread-specific on-stack BasicLockObject address to
     // a full-fledged "Thread *".
     _owner = Self;
-    return;
+    return true;
   }
 
   // We've encountered genuine contention.
   assert(Self->_Stalled == 0 || UseWispMonitor, "invariant");
   Self->_Stalled = intptr_t(this);
 
+  ObjectMonitorContention* const contention = contention_for_enter();
+  const jlong contended_nanos = contention != NULL ? os::javaTimeNanos() : 0;
+
   // Try one round of spinning *before* enqueueing Self
   // and before going through the awkward and expensive state
   // transitions.  The following spin is strictly optional ...
@@ -308,7 +311,10 @@ void ObjectMonitor::enter(TRAPS) {
     assert(_recursions == 0, "invariant");
     assert(((oop)(object()))->mark() == markOopDesc::encode(this), "invariant");
     Self->_Stalled = 0;
-    return;
+    if (contention != NULL) {
+      contention->record_acquire(os::javaTimeNanos() - contended_nanos);
+    }
+    return true;
   }
 
   assert(_owner != Self, "invariant");
@@ -317,12 +323,19 @@ void ObjectMonitor::enter(TRAPS) {
   JavaThread * jt = (JavaThread *) Self;
   assert(!SafepointSynchronize::is_at_safepoint(), "invariant");
   assert(jt->thread_state() != _thread_blocked, "invariant");
-  assert(this->object() != NULL, "invariant");
-  assert(_count >= 0, "invariant");
+  assert(this->object() != NULL || is_being_async_deflated(), "invariant");
+  assert(_count >= 0 || _owner == deflater_marker(), "invariant");
 
   // Prevent deflation at STW-time.  See deflate_idle_monitors() and is_busy().
   // Ensure the object-monitor relationship remains stable while there's contention.
-  Atomic::inc(&_count);
+  if (Atomic::add(1, &_count) <= 0) {
+    // The service thread deflated the monitor before our increment could
+    // stop it, see ObjectSynchronizer::deflate_monitor_async(). The caller
+    // retries with the object's restored header.
+    Atomic::dec(&_count);
+    Self->_Stalled = 0;
+    return false;
+  }
 
   JFR_ONLY(JfrConditionalFlushWithStacktrace<EventJavaMonitorEnter> flush(UseWispMonitor ? ((WispThread*)jt)->thread() : jt);)
   JFR_ONLY(WispPostStealHandleUpdateMark w(flush.thread_ref());)
@@ -392,6 +405,9 @@ void ObjectMonitor::enter(TRAPS) {
   Atomic::dec(&_count);
   assert(_count >= 0, "invariant");
   Self->_Stalled = 0;
+  if (contention != NULL) {
+    contention->record_acquire(os::javaTimeNanos() - contended_nanos);
+  }
 
   // Must either set _recursions = 0 or ASSERT _recursions == 0.
   assert(_recursions == 0, "invariant");
@@ -426,6 +442,7 @@ void ObjectMonitor::enter(TRAPS) {
     event.commit();
   }
   OM_PERFDATA_OP(ContendedLockAttempts, inc());
+  return true;
 }
 
 // Caveat: TryLock() is not necessarily serializing if it returns failure.
@@ -992,6 +1009,10 @@ void ObjectMonitor::exit(bool not_suspended, TRAPS) {
     return;
   }
 
+  if (_contention != NULL) {
+    _contention->record_release();
+  }
+
   // Invariant: after setting Responsible=null an thread must execute
   // a MEMBAR or other serializing instruction before fetching EntryList|cxq.
   if ((SyncFlags & 4) == 0) {
@@ -1418,16 +1439,18 @@ intptr_t ObjectMonitor::complete_exit(TRAPS) {
 
 // reenter() enters a lock and sets recursion count
 // complete_exit/reenter operate as a wait without waiting
-void ObjectMonitor::reenter(intptr_t recursions, TRAPS) {
+bool ObjectMonitor::reenter(intptr_t recursions, TRAPS) {
   Thread * const Self = THREAD;
   assert(Self->is_Java_thread(), "Must be Java thread!");
   JavaThread *jt = (JavaThread *)THREAD;
 
   guarantee(_owner != Self, "reenter already owner");
-  enter(THREAD);       // enter the monitor
+  if (!enter(THREAD)) {  // enter the monitor
+    return false;
+  }
   guarantee(_recursions == 0, "reenter recursion");
   _recursions = recursions;
-  return;
+  return true;
 }
 
 
@@ -2015,8 +2038,11 @@ int ObjectMonitor::TrySpin(Thread * Self) {
     return 0;
   }
 
+  ObjectMonitorContention* const contention = _contention;
+
   for (ctr = Knob_PreSpin + 1; --ctr >= 0;) {
     if (TryLock(Self) > 0) {
+      if (contention != NULL) contention->record_spin(true);
       // Increase _SpinDuration ...
       // Note that we don't clamp SpinDuration precisely at SpinLimit.
       // Raising _SpurDuration to the poverty line is key.
@@ -2044,6 +2070,24 @@ int ObjectMonitor::TrySpin(Thread * Self) {
   // This takes us into the realm of 1-out-of-N spinning, where we
   // hold the duration constant but vary the frequency.
 
+  // With UseAdaptiveMonitorSpinning the hold time and spin success
+  // statistics of the monitor decide whether spinning pays off at all.
+  if (contention != NULL) {
+    switch (contention->spin_policy()) {
+    case ObjectMonitorContention::Park:
+      TEVENT(Spin abort - long hold time);
+      return 0;
+    case ObjectMonitorContention::Yield: {
+      os::naked_yield();
+      bool acquired = TryLock(Self) > 0;
+      contention->record_spin(acquired);
+      return acquired ? 1 : 0;
+    }
+    default:
+      break;
+    }
+  }
+
   ctr = _SpinDuration;
   if (ctr < Knob_SpinBase) ctr = Knob_SpinBase;
   if (ctr <= 0) return 0;
@@ -2145,6 +2189,7 @@ int ObjectMonitor::TrySpin(Thread * Self) {
           _succ = NULL;
         }
         if (MaxSpin > 0) Adjust(&_Spinner, -1);
+        if (contention != NULL) contention->record_spin(true);
 
         // Increase _SpinDuration :
         // The spin was successful (profitable) so we tend toward
@@ -2218,11 +2263,132 @@ int ObjectMonitor::TrySpin(Thread * Self) {
     // in the normal usage of TrySpin(), but it's safest
     // to make TrySpin() as foolproof as possible.
     OrderAccess::fence();
-    if (TryLock(Self) > 0) return 1;
+    if (TryLock(Self) > 0) {
+      if (contention != NULL) contention->record_spin(true);
+      return 1;
+    }
   }
+  if (contention != NULL) contention->record_spin(false);
   return 0;
 }
 
+ObjectMonitorContention* ObjectMonitor::contention_for_enter() {
+  if (!UseAdaptiveMonitorSpinning) {
+    return NULL;
+  }
+  ObjectMonitorContention* contention = _contention;
+  if (contention == NULL) {
+    ObjectMonitorContention* c = new ObjectMonitorContention();
+    contention = Atomic::cmpxchg(c, &_contention, (ObjectMonitorContention*)NULL);
+    if (contention == NULL) {
+      contention = c;
+    } else {
+      delete c;
+    }
+  }
+  return contention;
+}
+
+// -----------------------------------------------------------------------------
+// Contention statistics
+
+void ObjectMonitorContention::reset() {
+  _contended_enters = 0;
+  _total_wait_nanos = 0;
+  _avg_hold_nanos = 0;
+  _spin_success = 1000;   // optimistic, like _SpinDuration
+  _acquired_nanos = 0;
+  for (int i = 0; i < HistogramBuckets; i++) {
+    _wait_histogram[i] = 0;
+    _hold_histogram[i] = 0;
+  }
+}
+
+int ObjectMonitorContention::bucket(jlong nanos) {
+  jlong micros = nanos / 1000;
+  int b = 0;
+  while (micros > 0 && b < HistogramBuckets - 1) {
+    micros >>= 1;
+    b++;
+  }
+  return b;
+}
+
+ObjectMonitorContention::SpinPolicy ObjectMonitorContention::spin_policy() const {
+  if (_avg_hold_nanos > AdaptiveSpinParkHoldNanos) {
+    // The owner keeps the monitor longer than a park/unpark round trip.
+    return Park;
+  }
+  if (_spin_success < AdaptiveSpinYieldSuccessPercent * 10) {
+    // Yield outcomes are recorded as well, so a monitor that became
+    // spin friendly again gets back to spinning.
+    return Yield;
+  }
+  return Spin;
+}
+
+const char* ObjectMonitorContention::spin_policy_name(SpinPolicy policy) {
+  switch (policy) {
+  case Spin:  return "spin";
+  case Yield: return "yield";
+  case Park:  return "park";
+  default:    return "unknown";
+  }
+}
+
+// Moving averages with a weight of 1/8 for the new sample.
+void ObjectMonitorContention::record_spin(bool success) {
+  int x = _spin_success;
+  _spin_success = x + (((success ? 1000 : 0) - x) >> 3);
+}
+
+void ObjectMonitorContention::record_acquire(jlong wait_nanos) {
+  _contended_enters++;
+  _total_wait_nanos += wait_nanos;
+  _wait_histogram[bucket(wait_nanos)]++;
+  _acquired_nanos = os::javaTimeNanos();
+}
+
+void ObjectMonitorContention::record_release() {
+  jlong acquired = _acquired_nanos;
+  if (acquired == 0) {
+    // Acquired without contention, the hold time is not sampled.
+    return;
+  }
+  _acquired_nanos = 0;
+  jlong hold = os::javaTimeNanos() - acquired;
+  jlong x = _avg_hold_nanos;
+  _avg_hold_nanos = x + ((hold - x) >> 3);
+  _hold_histogram[bucket(hold)]++;
+}
+
+void ObjectMonitorContention::print_histogram(outputStream* st, const char* name,
+                                              const volatile juint* histogram) {
+  st->print("   %s (us):", name);
+  for (int i = 0; i < HistogramBuckets; i++) {
+    if (histogram[i] != 0) {
+      if (i == 0) {
+        st->print(" <1:%u", histogram[i]);
+      } else if (i == HistogramBuckets - 1) {
+        st->print(" >=" JLONG_FORMAT ":%u", (jlong)1 << (i - 1), histogram[i]);
+      } else {
+        st->print(" " JLONG_FORMAT "-" JLONG_FORMAT ":%u",
+                  (jlong)1 << (i - 1), (jlong)1 << i, histogram[i]);
+      }
+    }
+  }
+  st->cr();
+}
+
+void ObjectMonitorContention::print_on(outputStream* st) const {
+  st->print_cr("   contended enters: " JLONG_FORMAT ", total wait: " JLONG_FORMAT " us, "
+               "average hold: " JLONG_FORMAT " ns, spin success: %d.%d%%, policy: %s",
+               _contended_enters, _total_wait_nanos / 1000, _avg_hold_nanos,
+               _spin_success / 10, _spin_success % 10, spin_policy_name(spin_policy()));
+  print_histogram(st, "wait", _wait_histogram);
+  print_histogram(st, "hold", _hold_histogram);
+}
+
 // NotRunnable() -- informed spinning
 //
 // Don't bother spinning if the owner is not eligible to drop the lock.
@@ -2378,6 +2544,8 @@ PerfCounter * ObjectMonitor::_sync_FutileWakeups               = NULL;
 PerfCounter * ObjectMonitor::_sync_Parks                       = NULL;
 PerfCounter * ObjectMonitor::_sync_Notifications               = NULL;
 PerfCounter * ObjectMonitor::_sync_Inflations                  = NULL;
+PerfCounter * ObjectMonitor::_sync_FastLockInflations          = NULL;
+PerfCounter * ObjectMonitor::_sync_LockStackOverflows          = NULL;
 PerfCounter * ObjectMonitor::_sync_Deflations                  = NULL;
 PerfLongVariable * ObjectMonitor::_sync_MonExtant              = NULL;
 
@@ -2403,6 +2571,8 @@ void ObjectMonitor::Initialize() {
                                          CHECK);                          \
   }
     NEWPERFCOUNTER(_sync_Inflations);
+    NEWPERFCOUNTER(_sync_FastLockInflations);
+    NEWPERFCOUNTER(_sync_LockStackOverflows);
     NEWPERFCOUNTER(_sync_Deflations);
     NEWPERFCOUNTER(_sync_ContendedLockAttempts);
     NEWPERFCOUNTER(_sync_FutileWakeups);
@@ -33,6 +33,45 @@
 
 class ObjectMonitor;
 
+// Contention statistics of a monitor, allocated on its first contended
+// enter with UseAdaptiveMonitorSpinning. They drive the spin policy in
+// ObjectMonitor::TrySpin() and are printed by Thread.contended_monitors.
+// The fields are updated without synchronization, racing updates only
+// make the numbers less precise.
+class ObjectMonitorContention : public CHeapObj<mtInternal> {
+ public:
+  enum SpinPolicy { Spin, Yield, Park };
+  enum { HistogramBuckets = 16 };    // power of two buckets of microseconds
+
+ private:
+  volatile jlong _contended_enters;  // enters that did not get the monitor right away
+  volatile jlong _total_wait_nanos;
+  volatile jlong _avg_hold_nanos;    // moving average of the hold time
+  volatile int   _spin_success;      // moving average of the spin success rate, per mille
+  volatile jlong _acquired_nanos;    // when the owner acquired the monitor after contention
+  volatile juint _wait_histogram[HistogramBuckets];
+  volatile juint _hold_histogram[HistogramBuckets];
+
+  static int bucket(jlong nanos);
+  static void print_histogram(outputStream* st, const char* name, const volatile juint* histogram);
+
+ public:
+  ObjectMonitorContention() { reset(); }
+  void reset();
+
+  SpinPolicy spin_policy() const;
+  static const char* spin_policy_name(SpinPolicy policy);
+
+  void record_spin(bool success);
+  void record_acquire(jlong wait_nanos);
+  void record_release();
+
+  jlong contended_enters() const { return _contended_enters; }
+  jlong total_wait_nanos() const { return _total_wait_nanos; }
+
+  void print_on(outputStream* st) const;
+};
+
 // ObjectWaiter serves as a "proxy" or surrogate thread.
 // TODO-FIXME: Eliminate ObjectWaiter and use the thread-specific
 // ParkEvent instead.  Beware, however, that the JVMTI code
@@ -156,8 +195,14 @@ class ObjectMonitor {
  public:
   // NOTE: Typed as uintptr_t so that we can pick it up in SA, via vmStructs.
   static const uintptr_t ANONYMOUS_OWNER = 1;
+  // Owner of a monitor that is being deflated by the service thread. A
+  // monitor with this owner cannot be acquired; it either goes back to NULL
+  // or the monitor is deflated. See "Asynchronous deflation" in
+  // synchronizer.cpp for the states a monitor read from a mark word can be in.
+  static const uintptr_t DEFLATER_MARKER = 2;
  private:
   static void* anon_owner_ptr() { return reinterpret_cast<void*>(ANONYMOUS_OWNER); }
+  static void* deflater_marker() { return reinterpret_cast<void*>(DEFLATER_MARKER); }
  protected:                         // protected for JvmtiRawMonitor
   void *  volatile _owner;          // pointer to owning thread OR BasicLock
   volatile jlong _previous_owner_tid;  // thread id of the previous owner of the monitor
@@ -176,11 +221,14 @@ class ObjectMonitor {
   volatile jint  _count;            // reference count to prevent reclamation/deflation
                                     // at stop-the-world time.  See deflate_idle_monitors().
                                     // _count is approximately |_WaitSet| + |_EntryList|
+                                    // It is set to -max_jint when the monitor is
+                                    // deflated asynchronously.
  protected:
   ObjectWaiter * volatile _WaitSet; // LL of threads wait()ing on the monitor
   volatile jint  _waiters;          // number of waiting threads
  private:
   volatile int _WaitSetLock;        // protects Wait Queue - simple spinlock
+  ObjectMonitorContention* volatile _contention;  // UseAdaptiveMonitorSpinning statistics
 
  public:
   static void Initialize();
@@ -202,6 +250,8 @@ class ObjectMonitor {
   static PerfCounter * _sync_Parks;
   static PerfCounter * _sync_Notifications;
   static PerfCounter * _sync_Inflations;
+  static PerfCounter * _sync_FastLockInflations;
+  static PerfCounter * _sync_LockStackOverflows;
   static PerfCounter * _sync_Deflations;
   static PerfLongVariable * _sync_MonExtant;
 
@@ -272,6 +322,12 @@ class ObjectMonitor {
     _owner = owner;
   }
 
+  // True if the monitor has been deflated by the service thread. Threads
+  // that raced with the deflation must retry with the object's new mark.
+  bool is_being_async_deflated() const {
+    return _count < 0;
+  }
+
   jint      waiters() const;
 
   jint      count() const;
@@ -279,6 +335,10 @@ class ObjectMonitor {
   jint      contentions() const;
   intptr_t  recursions() const                                         { return _recursions; }
 
+  // Contention statistics, NULL if the monitor has not been contended
+  // with UseAdaptiveMonitorSpinning.
+  ObjectMonitorContention* contention() const                          { return _contention; }
+
   // JVM/TI GetObjectMonitorUsage() needs this:
   ObjectWaiter* first_waiter()                                         { return _WaitSet; }
   ObjectWaiter* next_waiter(ObjectWaiter* o)                           { return o->_next; }
@@ -307,6 +367,10 @@ class ObjectMonitor {
     _cxq           = NULL;
     _WaitSet       = NULL;
     _recursions    = 0;
+    if (_contention != NULL) {
+      // The statistics belong to the previous object.
+      _contention->reset();
+    }
   }
 
  public:
@@ -321,7 +385,7 @@ class ObjectMonitor {
   static void sanity_checks();  // public for -XX:+ExecuteInternalVMTests
                                 // in PRODUCT for -XX:SyncKnobs=Verbose=1
 
-  void      enter(TRAPS);
+  bool      enter(TRAPS);       // false if the monitor was deflated concurrently
   void      exit(bool not_suspended, TRAPS);
   void      wait(jlong millis, bool interruptable, TRAPS);
   void      notify(TRAPS);
@@ -329,7 +393,7 @@ class ObjectMonitor {
 
 // Use the following at your own risk
   intptr_t  complete_exit(TRAPS);
-  void      reenter(intptr_t recursions, TRAPS);
+  bool      reenter(intptr_t recursions, TRAPS);
 
  private:
   void      AddWaiter(ObjectWaiter * waiter);
@@ -344,6 +408,7 @@ class ObjectMonitor {
   int       NotRunnable(Thread * Self, Thread * Owner);
   int       TrySpin(Thread * Self);
   void      ExitEpilog(Thread * Self, ObjectWaiter * Wakee);
+  ObjectMonitorContention* contention_for_enter();
   bool      ExitSuspendEquivalent(JavaThread * Self);
 };
 
@@ -574,6 +574,8 @@ class os: AllStatic {
 
   // run cmd in a separate process and return its exit code; or -1 on failures
   static int fork_and_exec(char *cmd, bool use_vfork_if_available = false);
+  // run argv[0] with the arguments argv without a shell, argv ends with NULL
+  static int fork_and_exec(char* const argv[]);
 
   // Call ::exit() on all platforms but Windows
   static void exit(int num);
@@ -24,6 +24,7 @@
 
 #include "precompiled.hpp"
 #include "classfile/classLoaderData.hpp"
+#include "classfile/dictionary.hpp"
 #include "classfile/stringTable.hpp"
 #include "classfile/symbolTable.hpp"
 #include "classfile/systemDictionary.hpp"
@@ -38,6 +39,7 @@
 #include "gc/shared/workgroup.hpp"
 #include "interpreter/interpreter.hpp"
 #include "jfr/jfrEvents.hpp"
+#include "jfr/support/jfrThreadId.hpp"
 #include "logging/log.hpp"
 #include "logging/logStream.hpp"
 #include "memory/resourceArea.hpp"
@@ -164,6 +166,7 @@ void SafepointSynchronize::begin() {
     _safepoint_begin_time = os::javaTimeNanos();
     _ts_of_current_safepoint = tty->time_stamp().seconds();
   }
+  jlong sync_begin_time = TimeToSafepointTopThreads > 0 ? os::javaTimeNanos() : 0;
 
   Universe::heap()->safepoint_synchronize_begin();
 
@@ -461,6 +464,10 @@ void SafepointSynchronize::begin() {
     }
   }
 
+  if (TimeToSafepointTopThreads > 0) {
+    report_slowest_threads(sync_begin_time);
+  }
+
 #ifdef ASSERT
   // Make sure all the threads were visited.
   for (JavaThreadIteratorWithHandle jtiwh; JavaThread *cur = jtiwh.next(); ) {
@@ -552,6 +559,11 @@ void SafepointSynchronize::end() {
           ThreadSafepointState* cur_state = current->safepoint_state();
           cur_state->restart(); // TSS _running
           SafepointMechanism::disarm_local_poll(current);
+          OrderAccess::fence();
+          if (current->has_handshake()) {
+            // Keep polling for asynchronous handshakes queued meanwhile
+            SafepointMechanism::arm_local_poll(current);
+          }
         }
         log_info(safepoint)("Leaving safepoint region");
       } else {
@@ -610,6 +622,9 @@ bool SafepointSynchronize::is_cleanup_needed() {
   if (!InlineCacheBuffer::is_empty()) return true;
   if (StringTable::needs_rehashing()) return true;
   if (SymbolTable::needs_rehashing()) return true;
+  // Dictionaries are only resized at a safepoint, and lock-free lookups
+  // walk the overlong chains until then.
+  if (Dictionary::does_any_dictionary_needs_resizing()) return true;
   return false;
 }
 
@@ -865,6 +880,9 @@ void SafepointSynchronize::block(JavaThread *thread) {
         assert(_waiting_to_block > 0, "sanity check");
         _waiting_to_block--;
         thread->safepoint_state()->set_has_called_back(true);
+        if (TimeToSafepointTopThreads > 0) {
+          thread->safepoint_state()->record_reached(state);
+        }
 
         DEBUG_ONLY(thread->set_visited_for_critical_count(true));
         if (thread->in_critical()) {
@@ -1033,6 +1051,115 @@ void SafepointSynchronize::print_safepoint_timeout(SafepointTimeoutReason reason
   }
 }
 
+// Defined in thread.cpp
+const char* _get_thread_state_name(JavaThreadState _thread_state);
+
+// Describes where a thread stopped for the safepoint: the Java method of its
+// last frame and, for compiled code, whether it stopped at a loop poll, only
+// at the return poll of the method (i.e. it ran through loops without polls)
+// or at a call into the runtime.
+static Method* safepoint_stop_of(JavaThread* thread, address* pc, const char** stop) {
+  *pc = NULL;
+  *stop = "no Java frame";
+  if (!thread->has_last_Java_frame()) {
+    return NULL;
+  }
+  RegisterMap map(thread, false);
+  frame fr = thread->last_frame();
+  while (fr.is_runtime_frame() || fr.is_safepoint_blob_frame()) {
+    fr = fr.sender(&map);
+  }
+  *pc = fr.pc();
+  if (fr.is_interpreted_frame()) {
+    *stop = "interpreted";
+    return fr.interpreter_frame_method();
+  }
+  if (fr.is_native_frame()) {
+    *stop = "native";
+    return fr.cb()->as_compiled_method()->method();
+  }
+  if (fr.is_compiled_frame()) {
+    CompiledMethod* cm = fr.cb()->as_compiled_method();
+    if (!TimeToSafepointCodeAttribution) {
+      *stop = "compiled";
+    } else if (cm->is_at_poll_return(*pc)) {
+      *stop = "compiled, return poll";
+    } else if (cm->is_at_poll_or_poll_return(*pc)) {
+      *stop = "compiled, loop poll";
+    } else {
+      *stop = "compiled, call";
+    }
+    return cm->method();
+  }
+  *stop = "unknown frame";
+  return NULL;
+}
+
+// Reports the TimeToSafepointTopThreads threads that took longest to reach
+// the current safepoint. All threads are stopped, so their stacks can be
+// walked to find out where they were.
+void SafepointSynchronize::report_slowest_threads(jlong sync_begin_time) {
+  assert(Thread::current()->is_VM_thread(), "Only VM thread may report safepoint outliers");
+  const int top = (int)TimeToSafepointTopThreads;
+  LogTarget(Info, safepoint, stats) lt;
+  if (!lt.is_enabled() && !EventSafepointSlowThread::is_enabled()) {
+    return;
+  }
+
+  ResourceMark rm;
+  ThreadSafepointState** slowest = NEW_RESOURCE_ARRAY(ThreadSafepointState*, top);
+  int count = 0;
+  int nof_threads = 0;
+  JavaThreadIteratorWithHandle jtiwh;
+  for (; JavaThread* cur = jtiwh.next(); nof_threads++) {
+    ThreadSafepointState* cur_state = cur->safepoint_state();
+    jlong reached = cur_state->reached_time();
+    if (count == top && reached <= slowest[top - 1]->reached_time()) {
+      continue;
+    }
+    // Keep the slowest threads sorted by descending reach time
+    int i = count < top ? count++ : top - 1;
+    for (; i > 0 && slowest[i - 1]->reached_time() < reached; i--) {
+      slowest[i] = slowest[i - 1];
+    }
+    slowest[i] = cur_state;
+  }
+
+  LogStream ls(lt);
+  if (lt.is_enabled()) {
+    ls.print_cr("Time to safepoint: %s, %d slowest of %d threads",
+                VMThread::vm_safepoint_description(), count, nof_threads);
+  }
+  for (int i = 0; i < count; i++) {
+    ThreadSafepointState* cur_state = slowest[i];
+    JavaThread* cur = cur_state->thread();
+    jlong ttsp = cur_state->reached_time() == 0 ? 0 : cur_state->reached_time() - sync_begin_time;
+    address pc;
+    const char* stop;
+    Method* method = safepoint_stop_of(cur, &pc, &stop);
+    if (lt.is_enabled()) {
+      ls.print_cr("  %d: " JLONG_FORMAT " ns, examined %d times, %s -> %s, stopped in %s at " INTPTR_FORMAT " (%s), thread \"%s\"",
+                  i + 1, ttsp, cur_state->examine_count(),
+                  _get_thread_state_name(cur_state->first_thread_state()),
+                  _get_thread_state_name(cur_state->reached_thread_state()),
+                  method != NULL ? method->name_and_sig_as_C_string() : "<unknown>",
+                  p2i(pc), stop, cur->get_thread_name());
+    }
+    EventSafepointSlowThread event;
+    if (event.should_commit()) {
+      set_current_safepoint_id(&event);
+      event.set_slowThread(JFR_THREAD_ID(cur));
+      event.set_timeToSafepoint(ttsp);
+      event.set_initialState(_get_thread_state_name(cur_state->first_thread_state()));
+      event.set_reachedState(_get_thread_state_name(cur_state->reached_thread_state()));
+      event.set_method(method);
+      event.set_pc((u8)p2i(pc));
+      event.set_stop(stop);
+      event.commit();
+    }
+  }
+}
+
 
 // -------------------------------------------------------------------------------------------------------
 // Implementation of ThreadSafepointState
@@ -1042,6 +1169,10 @@ ThreadSafepointState::ThreadSafepointState(JavaThread *thread) {
   _type   = _running;
   _has_called_back = false;
   _at_poll_safepoint = false;
+  _reached_time = 0;
+  _first_thread_state = _thread_uninitialized;
+  _reached_thread_state = _thread_uninitialized;
+  _examine_count = 0;
 }
 
 void ThreadSafepointState::create(JavaThread *thread) {
@@ -1063,6 +1194,9 @@ void ThreadSafepointState::examine_state_of_thread() {
 
   // Save the state at the start of safepoint processing.
   _orig_thread_state = state;
+  if (_examine_count++ == 0) {
+    _first_thread_state = state;
+  }
 
   // Check for a thread that is suspended. Note that thread resume tries
   // to grab the Threads_lock which we own here, so a thread cannot be
@@ -1119,6 +1253,9 @@ void ThreadSafepointState::roll_forward(suspend_type type) {
 
   switch(_type) {
     case _at_safepoint:
+      if (TimeToSafepointTopThreads > 0) {
+        record_reached(_thread->thread_state());
+      }
       SafepointSynchronize::signal_thread_at_safepoint();
       DEBUG_ONLY(_thread->set_visited_for_critical_count(true));
       if (_thread->in_critical()) {
@@ -1152,6 +1289,17 @@ void ThreadSafepointState::restart() {
   }
   _type = _running;
   set_has_called_back(false);
+  _reached_time = 0;
+  _examine_count = 0;
+}
+
+// Called by the VM thread when it finds the thread safe, or by the thread
+// itself when it blocks for the safepoint, whichever happens first.
+void ThreadSafepointState::record_reached(JavaThreadState state) {
+  if (_reached_time == 0) {
+    _reached_thread_state = state;
+    _reached_time = os::javaTimeNanos();
+  }
 }
 
 
@@ -143,6 +143,9 @@ private:
   // For debug long safepoint
   static void print_safepoint_timeout(SafepointTimeoutReason timeout_reason);
 
+  // Time-to-safepoint tracing, see TimeToSafepointTopThreads
+  static void report_slowest_threads(jlong sync_begin_time);
+
 public:
 
   // Main entry points
@@ -244,6 +247,11 @@ class ThreadSafepointState: public CHeapObj<mtThread> {
   volatile suspend_type          _type;
   JavaThreadState                _orig_thread_state;
 
+  // Time-to-safepoint tracing, see TimeToSafepointTopThreads
+  jlong                          _reached_time;          // javaTimeNanos() when the thread reached the safepoint, 0 if not yet
+  JavaThreadState                _first_thread_state;    // state when the thread was examined first
+  JavaThreadState                _reached_thread_state;  // state in which the thread reached the safepoint
+  int                            _examine_count;         // number of times the thread was found running
 
  public:
   ThreadSafepointState(JavaThread *thread);
@@ -261,6 +269,13 @@ class ThreadSafepointState: public CHeapObj<mtThread> {
   bool         is_at_call_back() const{ return (_type == _call_back);}
   JavaThreadState orig_thread_state() const { return _orig_thread_state; }
 
+  // Time-to-safepoint tracing
+  void            record_reached(JavaThreadState state);
+  jlong           reached_time() const         { return _reached_time; }
+  JavaThreadState first_thread_state() const   { return _first_thread_state; }
+  JavaThreadState reached_thread_state() const { return _reached_thread_state; }
+  int             examine_count() const        { return _examine_count; }
+
   // Support for safepoint timeout (debugging)
   bool has_called_back() const                   { return _has_called_back; }
   void set_has_called_back(bool val)             { _has_called_back = val; }
@@ -24,11 +24,13 @@
 
 #include "precompiled.hpp"
 #include "classfile/stringTable.hpp"
+#include "classfile/symbolTable.hpp"
 #include "runtime/interfaceSupport.inline.hpp"
 #include "runtime/javaCalls.hpp"
 #include "runtime/serviceThread.hpp"
 #include "runtime/mutexLocker.hpp"
 #include "runtime/os.hpp"
+#include "runtime/synchronizer.hpp"
 #include "prims/jvmtiImpl.hpp"
 #include "services/diagnosticArgument.hpp"
 #include "services/diagnosticFramework.hpp"
@@ -89,6 +91,8 @@ void ServiceThread::service_thread_entry(JavaThread* jt, TRAPS) {
     bool has_dcmd_notification_event = false;
     bool acs_notify = false;
     bool stringtable_work = false;
+    bool symboltable_work = false;
+    bool deflate_idle_monitors = false;
     JvmtiDeferredEvent jvmti_event;
     {
       // Need state transition ThreadBlockInVM so that this thread
@@ -106,10 +110,14 @@ void ServiceThread::service_thread_entry(JavaThread* jt, TRAPS) {
              !(has_jvmti_events = _jvmti_service_queue.has_events()) &&
               !(has_gc_notification_event = GCNotifier::has_event()) &&
               !(has_dcmd_notification_event = DCmdFactory::has_pending_jmx_notification()) &&
-              !(stringtable_work = StringTable::has_work())) {
+              !(stringtable_work = StringTable::has_work()) &&
+              !(symboltable_work = SymbolTable::has_work()) &&
+              !(deflate_idle_monitors = ObjectSynchronizer::is_async_deflation_needed())) {
         // wait until one of the sensors has pending requests, or there is a
-        // pending JVMTI event or JMX GC notification to post
-        Service_lock->wait(Mutex::_no_safepoint_check_flag);
+        // pending JVMTI event or JMX GC notification to post. With async
+        // monitor deflation, wake up periodically to check the monitor usage.
+        Service_lock->wait(Mutex::_no_safepoint_check_flag,
+                           ObjectSynchronizer::is_async_deflation_enabled() ? AsyncDeflationInterval : 0);
       }
 
       if (has_jvmti_events) {
@@ -123,6 +131,14 @@ void ServiceThread::service_thread_entry(JavaThread* jt, TRAPS) {
       StringTable::do_concurrent_work(jt);
     }
 
+    if (symboltable_work) {
+      SymbolTable::do_concurrent_work(jt);
+    }
+
+    if (deflate_idle_monitors) {
+      ObjectSynchronizer::deflate_idle_monitors_async();
+    }
+
     if (has_jvmti_events) {
       _jvmti_event->post();
       _jvmti_event = NULL;  // reset
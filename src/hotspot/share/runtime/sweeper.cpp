@@ -32,10 +32,12 @@
 #include "logging/log.hpp"
 #include "logging/logStream.hpp"
 #include "memory/allocation.inline.hpp"
+#include "memory/heap.hpp"
 #include "memory/resourceArea.hpp"
 #include "oops/method.hpp"
 #include "runtime/atomic.hpp"
 #include "runtime/compilationPolicy.hpp"
+#include "runtime/handshake.hpp"
 #include "runtime/interfaceSupport.inline.hpp"
 #include "runtime/mutexLocker.hpp"
 #include "runtime/orderAccess.hpp"
@@ -198,7 +200,8 @@ bool NMethodSweeper::wait_for_stack_scanning() {
 /**
   * Scans the stacks of all Java threads and marks activations of not-entrant methods.
   * No need to synchronize access, since 'mark_active_nmethods' is always executed at a
-  * safepoint.
+  * safepoint. With SweeperUseHandshakes the stacks are scanned by do_stack_scanning()
+  * instead.
   */
 void NMethodSweeper::mark_active_nmethods() {
   CodeBlobClosure* cl = prepare_mark_active_nmethods();
@@ -218,6 +221,17 @@ CodeBlobClosure* NMethodSweeper::prepare_mark_active_nmethods() {
   // Increase time so that we can estimate when to invoke the sweeper again.
   _time_counter++;
 
+  if (SweeperUseHandshakes) {
+    // Stacks are scanned with a handshake by the sweeper thread, keep the
+    // safepoint cleanup free of stack walks.
+    return NULL;
+  }
+  return prepare_stack_scanning();
+}
+
+CodeBlobClosure* NMethodSweeper::prepare_stack_scanning() {
+  assert(SafepointSynchronize::is_at_safepoint() || CodeCache_lock->owned_by_self(), "sweeper state must be stable");
+
   // Check for restart
   if (_current.method() != NULL) {
     if (_current.method()->is_nmethod()) {
@@ -249,15 +263,39 @@ CodeBlobClosure* NMethodSweeper::prepare_mark_active_nmethods() {
 
 }
 
+class NMethodMarkingClosure : public HandshakeClosure {
+ private:
+  CodeBlobClosure* _cl;
+ public:
+  NMethodMarkingClosure(CodeBlobClosure* cl) : HandshakeClosure("NMethodMarking"), _cl(cl) {}
+  void do_thread(Thread* th) {
+    if (th->is_Java_thread() && !th->is_Code_cache_sweeper_thread()) {
+      ((JavaThread*)th)->nmethods_do(_cl);
+    }
+  }
+};
+
 /**
   * This function triggers a VM operation that does stack scanning of active
   * methods. Stack scanning is mandatory for the sweeper to make progress.
+  * With SweeperUseHandshakes the stacks are scanned thread by thread in a
+  * handshake, so the sweeper never stops the world.
   */
 void NMethodSweeper::do_stack_scanning() {
   assert(!CodeCache_lock->owned_by_self(), "just checking");
   if (wait_for_stack_scanning()) {
-    VM_MarkActiveNMethods op;
-    VMThread::execute(&op);
+    if (SweeperUseHandshakes) {
+      CodeBlobClosure* code_cl;
+      {
+        MutexLockerEx ccl(CodeCache_lock, Mutex::_no_safepoint_check_flag);
+        code_cl = prepare_stack_scanning();
+      }
+      NMethodMarkingClosure nm_cl(code_cl);
+      Handshake::execute(&nm_cl);
+    } else {
+      VM_MarkActiveNMethods op;
+      VMThread::execute(&op);
+    }
     _should_sweep = true;
   }
 }
@@ -380,8 +418,13 @@ void NMethodSweeper::possibly_sweep() {
   }
 
   if (_should_sweep || forced) {
+    if (SweeperUseHandshakes) {
+      // Safepoints do not start a new traversal, scan the stacks here
+      do_stack_scanning();
+    }
     init_sweeper_log();
     sweep_code_cache();
+    possibly_defragment_code_heaps();
 
     // We are done with sweeping the code cache once.
     _total_nof_code_cache_sweeps++;
@@ -676,6 +719,7 @@ NMethodSweeper::MethodStateChange NMethodSweeper::process_compiled_method(Compil
   } else {
     if (cm->is_nmethod()) {
       possibly_flush((nmethod*)cm);
+      possibly_relocate_hot((nmethod*)cm);
     }
     // Clean inline caches that point to zombie/non-entrant/unloaded nmethods
     MutexLocker cl(CompiledIC_lock);
@@ -768,6 +812,88 @@ void NMethodSweeper::possibly_flush(nmethod* nm) {
   }
 }
 
+// C2-compiled methods that only got hot after they were compiled live
+// outside of the hot code heap. Make them not entrant so that they are
+// recompiled into it. The method must have been seen on stack since the
+// last sweep and there must be room left in the hot code heap.
+void NMethodSweeper::possibly_relocate_hot(nmethod* nm) {
+  if (HotCodeRelocation && nm->is_in_use() && !nm->is_osr_method() && !nm->is_locked_by_vm() &&
+      nm->comp_level() == CompLevel_full_optimization &&
+      CodeCache::heap_available(CodeBlobType::MethodHot) &&
+      CodeCache::get_code_blob_type(nm) != CodeBlobType::MethodHot &&
+      hotness_counter_reset_val() - nm->hotness_counter() <= 1 &&
+      CodeCache::unallocated_capacity(CodeBlobType::MethodHot) > 2 * (size_t)nm->size() &&
+      CodeCache::is_hot_method(nm->method())) {
+    if (PrintMethodFlushing && Verbose) {
+      tty->print_cr("### Nmethod %d/" PTR_FORMAT " made not-entrant: relocating to hot code heap",
+          nm->compile_id(), p2i(nm));
+    }
+    nm->make_not_entrant();
+  }
+}
+
+// A nmethod between two free blocks splits the free space of its code heap.
+// If most of the free space of a heap lies outside of its largest free
+// block, make such nmethods not entrant: flushing them merges the free
+// blocks around them, and the ones still in use get recompiled into the
+// largest free block. Only as much code as fits into half of the largest
+// free block is evicted per sweep.
+void NMethodSweeper::possibly_defragment_code_heaps() {
+  if (!CodeCacheDefragmentation) {
+    return;
+  }
+  ResourceMark rm;
+  GrowableArray<nmethod*> isolated;
+  {
+    MutexLockerEx mu(CodeCache_lock, Mutex::_no_safepoint_check_flag);
+    const GrowableArray<CodeHeap*>* heaps = CodeCache::nmethod_heaps();
+    for (int i = 0; i < heaps->length(); i++) {
+      CodeHeap* heap = heaps->at(i);
+      size_t free = heap->unallocated_capacity();
+      size_t largest = heap->largest_free_block();
+      if (free == 0 || free > heap->max_capacity() / 2 ||
+          (free - largest) * 100 < free * MIN2(CodeCacheDefragmentationThreshold, (uintx)100)) {
+        continue;
+      }
+      size_t budget = largest / 2;
+      for (FreeBlock* f = heap->freelist(); f != NULL; f = f->link()) {
+        HeapBlock* used = heap->next_block(f);
+        if (used == NULL || used->free()) {
+          continue;
+        }
+        HeapBlock* next = heap->next_block(used);
+        if (next == NULL || !next->free()) {
+          continue;
+        }
+        CodeBlob* cb = (CodeBlob*)used->allocated_space();
+        if (cb->is_nmethod()) {
+          nmethod* nm = cb->as_nmethod();
+          if (nm->is_in_use() && !nm->is_osr_method() && !nm->is_native_method() &&
+              (size_t)nm->size() <= budget) {
+            budget -= nm->size();
+            isolated.append(nm);
+          }
+        }
+      }
+    }
+  }
+
+  // Only the sweeper flushes nmethods, so they are still there
+  for (int i = 0; i < isolated.length(); i++) {
+    nmethod* nm = isolated.at(i);
+    if (nm->is_in_use() && !nm->is_locked_by_vm()) {
+      if (PrintMethodFlushing && Verbose) {
+        tty->print_cr("### Nmethod %d/" PTR_FORMAT " made not-entrant: defragmenting code heap",
+            nm->compile_id(), p2i(nm));
+      }
+      nm->make_not_entrant();
+    }
+  }
+  if (isolated.length() > 0) {
+    log_debug(codecache, sweep)("Defragmenting code cache: %d nmethods made not entrant", isolated.length());
+  }
+}
+
 // Print out some state information about the current sweep and the
 // state of the code cache if it's requested.
 void NMethodSweeper::log_sweep(const char* msg, const char* format, ...) {
@@ -39,6 +39,8 @@ class CodeBlobClosure;
 //  1) mark active nmethods
 //     Is done in 'mark_active_nmethods()'. This function is called at a
 //     safepoint and marks all nmethods that are active on a thread's stack.
+//     With SweeperUseHandshakes the sweeper thread does this itself in
+//     'do_stack_scanning()' with a handshake, one thread at a time.
 //  2) sweep nmethods
 //     Is done in sweep_code_cache(). This function is the only place in the
 //     sweeper where memory is reclaimed. Note that sweep_code_cache() is not
@@ -95,7 +97,9 @@ class NMethodSweeper : public AllStatic {
   static void sweep_code_cache();
   static void handle_safepoint_request();
   static void do_stack_scanning();
+  static CodeBlobClosure* prepare_stack_scanning();
   static void possibly_sweep();
+  static void possibly_defragment_code_heaps();
  public:
   static long traversal_count()              { return _traversals; }
   static int  total_nof_methods_reclaimed()  { return _total_nof_methods_reclaimed; }
@@ -122,6 +126,7 @@ class NMethodSweeper : public AllStatic {
   static void report_state_change(nmethod* nm);
   static void possibly_enable_sweeper();
   static void possibly_flush(nmethod* nm);
+  static void possibly_relocate_hot(nmethod* nm);
   static void print(outputStream* out);   // Printing/debugging
   static void print() { print(tty); }
 };
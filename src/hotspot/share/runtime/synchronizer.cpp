@@ -36,6 +36,7 @@
 #include "runtime/biasedLocking.hpp"
 #include "runtime/coroutine.hpp"
 #include "runtime/handles.inline.hpp"
+#include "runtime/handshake.hpp"
 #include "runtime/interfaceSupport.inline.hpp"
 #include "runtime/lockStack.inline.hpp"
 #include "runtime/mutexLocker.hpp"
@@ -47,6 +48,7 @@
 #include "runtime/stubRoutines.hpp"
 #include "runtime/synchronizer.hpp"
 #include "runtime/thread.inline.hpp"
+#include "runtime/threadSMR.hpp"
 #include "runtime/vframe.hpp"
 #include "runtime/vmThread.hpp"
 #include "utilities/align.hpp"
@@ -229,7 +231,7 @@ bool ObjectSynchronizer::quick_enter(oop obj, Thread * Self,
 
   if (mark->has_monitor()) {
     ObjectMonitor * const m = mark->monitor();
-    assert(m->object() == obj, "invariant");
+    assert(m->object() == obj || m->is_being_async_deflated(), "invariant");
     Thread * const owner = (Thread *) m->_owner;
 
     // Lock contention and Transactional Lock Elision (TLE) diagnostics
@@ -505,6 +507,14 @@ void ObjectSynchronizer::slow_enter(Handle obj, BasicLock* lock, TRAPS) {
     assert(THREAD->is_Java_thread(), "sanity");
     JavaThread* jt = (JavaThread*)THREAD;
     LockStack& lock_stack = jt->lock_stack();
+    if (!lock_stack.can_push()) {
+      // Make room by inflating the least recently fast-locked object. That
+      // one is most likely an outer lock held for long, while the lock
+      // taken now is an inner one that stays cheap when fast-locked.
+      OM_PERFDATA_OP(LockStackOverflows, inc());
+      ObjectSynchronizer::inflate(THREAD, lock_stack.bottom(), inflate_cause_lock_stack_full);
+      assert(lock_stack.can_push(), "inflation must have made room");
+    }
     if (lock_stack.can_push()) {
       markOop mark = obj()->mark();
       if (mark->is_neutral()) {
@@ -546,9 +556,12 @@ void ObjectSynchronizer::slow_enter(Handle obj, BasicLock* lock, TRAPS) {
     // and must not look locked either.
     lock->set_displaced_header(markOopDesc::unused_mark());
   }
-  ObjectSynchronizer::inflate(THREAD,
-                              obj(),
-                              inflate_cause_monitor_enter)->enter(THREAD);
+  // An asynchronously deflated monitor can no longer be entered,
+  // inflate the object again.
+  while (!ObjectSynchronizer::inflate(THREAD,
+                                      obj(),
+                                      inflate_cause_monitor_enter)->enter(THREAD)) {
+  }
 }
 
 // This routine is used to handle interpreter/compiler slow case
@@ -597,11 +610,15 @@ void ObjectSynchronizer::reenter(Handle obj, intptr_t recursion, TRAPS) {
     assert(!obj->mark()->has_bias_pattern(), "biases should be revoked by now");
   }
 
-  ObjectMonitor* monitor = ObjectSynchronizer::inflate(THREAD,
-                                                       obj(),
-                                                       inflate_cause_vm_internal);
+  for (;;) {
+    ObjectMonitor* monitor = ObjectSynchronizer::inflate(THREAD,
+                                                         obj(),
+                                                         inflate_cause_vm_internal);
 
-  monitor->reenter(recursion, THREAD);
+    if (monitor->reenter(recursion, THREAD)) {
+      return;
+    }
+  }
 }
 // -----------------------------------------------------------------------------
 // JNI locks on java objects
@@ -614,7 +631,8 @@ void ObjectSynchronizer::jni_enter(Handle obj, TRAPS) {
     assert(!obj->mark()->has_bias_pattern(), "biases should be revoked by now");
   }
   THREAD->set_current_pending_monitor_is_from_java(false);
-  ObjectSynchronizer::inflate(THREAD, obj(), inflate_cause_jni_enter)->enter(THREAD);
+  while (!ObjectSynchronizer::inflate(THREAD, obj(), inflate_cause_jni_enter)->enter(THREAD)) {
+  }
   THREAD->set_current_pending_monitor_is_from_java(true);
 }
 
@@ -787,6 +805,9 @@ struct SharedGlobals {
 static SharedGlobals GVars;
 static int MonitorScavengeThreshold = 1000000;
 static volatile int ForceMonitorScavenge = 0; // Scavenge required and pending
+static volatile int AsyncDeflationRequested = 0; // Async deflation forced by MonitorBound
+static volatile int AsyncDeflationSafepoint = 0; // A safepoint skipped deflation since the last one
+static jlong LastAsyncDeflation = 0;             // End of the last async deflation in ms
 
 static markOop ReadStableMark(oop obj) {
   markOop mark = obj->mark();
@@ -921,6 +942,24 @@ static bool is_lock_owned(Thread* thread, oop obj) {
   return thread->is_Java_thread() ? reinterpret_cast<JavaThread*>(thread)->lock_stack().contains(obj) : false;
 }
 
+// A hash code read from or installed into the header of a monitor that is
+// being deflated asynchronously may not make it into the restored object
+// header. Wait until the deflater is done with the object so that the
+// caller can start over.
+static bool wait_for_async_deflation(ObjectMonitor* monitor, oop obj) {
+  if (!AsyncDeflateIdleMonitors) {
+    return false;
+  }
+  OrderAccess::fence();
+  if (!monitor->is_being_async_deflated()) {
+    return false;
+  }
+  while (obj->mark() == markOopDesc::encode(monitor)) {
+    SpinPause();
+  }
+  return true;
+}
+
 intptr_t ObjectSynchronizer::FastHashCode(Thread * Self, oop obj) {
   if (UseBiasedLocking) {
     // NOTE: many places throughout the JVM do not expect a safepoint
@@ -981,6 +1020,9 @@ intptr_t ObjectSynchronizer::FastHashCode(Thread * Self, oop obj) {
     assert(temp->is_neutral(), "invariant");
     hash = temp->hash();
     if (hash) {
+      if (wait_for_async_deflation(monitor, obj)) {
+        return FastHashCode(Self, obj);
+      }
       return hash;
     }
     // Skip to the following code to reduce code size
@@ -1029,6 +1071,9 @@ intptr_t ObjectSynchronizer::FastHashCode(Thread * Self, oop obj) {
       assert(hash != 0, "Trivial unexpected object/monitor header usage.");
     }
   }
+  if (wait_for_async_deflation(monitor, obj)) {
+    return FastHashCode(Self, obj);
+  }
   // We finally get the hash
   return hash;
 }
@@ -1218,6 +1263,10 @@ static bool monitors_used_above_threshold() {
 }
 
 bool ObjectSynchronizer::is_cleanup_needed() {
+  if (is_async_deflation_enabled()) {
+    // Idle monitors are deflated by the service thread.
+    return false;
+  }
   if (MonitorUsedDeflationThreshold > 0) {
     return monitors_used_above_threshold();
   }
@@ -1313,6 +1362,13 @@ static void InduceScavenge(Thread * Self, const char * Whence) {
   // of active monitors passes the specified threshold.
   // TODO: assert thread state is reasonable
 
+  if (ObjectSynchronizer::is_async_deflation_enabled()) {
+    // No safepoint needed, the service thread checks for the request
+    // every AsyncDeflationInterval.
+    AsyncDeflationRequested = 1;
+    return;
+  }
+
   if (ForceMonitorScavenge == 0 && Atomic::xchg (1, &ForceMonitorScavenge) == 0) {
     if (ObjectMonitor::Knob_Verbose) {
       tty->print_cr("INFO: Monitor scavenge - Induced STW @%s (%d)",
@@ -1667,7 +1723,7 @@ ObjectMonitor* ObjectSynchronizer::inflate(Thread * Self,
     if (mark->has_monitor()) {
       ObjectMonitor * inf = mark->monitor();
       assert(inf->header()->is_neutral(), "invariant");
-      assert(inf->object() == object, "invariant");
+      assert(inf->object() == object || inf->is_being_async_deflated(), "invariant");
       assert(ObjectSynchronizer::verify_objmon_isinpool(inf), "monitor is invalid");
       if (UseAltFastLocking && inf->is_owner_anonymous() && is_lock_owned(Self, object)) {
         if (UseWispMonitor) {
@@ -1735,12 +1791,14 @@ ObjectMonitor* ObjectSynchronizer::inflate(Thread * Self,
         // Hopefully the performance counters are allocated on distinct
         // cache lines to avoid false sharing on MP systems ...
         OM_PERFDATA_OP(Inflations, inc());
+        OM_PERFDATA_OP(FastLockInflations, inc());
         if (log_is_enabled(Debug, monitorinflation)) {
           if (object->is_instance()) {
             ResourceMark rm;
-            log_debug(monitorinflation)("Inflating object " INTPTR_FORMAT " , mark " INTPTR_FORMAT " , type %s",
+            log_debug(monitorinflation)("Inflating fast-locked object " INTPTR_FORMAT " , mark " INTPTR_FORMAT " , type %s , cause %s",
                                         p2i(object), p2i(object->mark()),
-                                        object->klass()->external_name());
+                                        object->klass()->external_name(),
+                                        inflate_cause_name(cause));
           }
         }
         if (event.should_commit()) {
@@ -2007,7 +2065,8 @@ bool ObjectSynchronizer::deflate_monitor(ObjectMonitor* mid, oop obj,
 // Threads::parallel_java_threads_do() in thread.cpp.
 int ObjectSynchronizer::deflate_monitor_list(ObjectMonitor** listHeadp,
                                              ObjectMonitor** freeHeadp,
-                                             ObjectMonitor** freeTailp) {
+                                             ObjectMonitor** freeTailp,
+                                             bool async) {
   ObjectMonitor* mid;
   ObjectMonitor* next;
   ObjectMonitor* cur_mid_in_use = NULL;
@@ -2015,7 +2074,8 @@ int ObjectSynchronizer::deflate_monitor_list(ObjectMonitor** listHeadp,
 
   for (mid = *listHeadp; mid != NULL;) {
     oop obj = (oop) mid->object();
-    if (obj != NULL && deflate_monitor(mid, obj, freeHeadp, freeTailp)) {
+    if (obj != NULL && (async ? deflate_monitor_async(mid, obj, freeHeadp, freeTailp)
+                              : deflate_monitor(mid, obj, freeHeadp, freeTailp))) {
       // if deflate_monitor succeeded,
       // extract from per-thread in-use list
       if (mid == *listHeadp) {
@@ -2043,6 +2103,11 @@ void ObjectSynchronizer::prepare_deflate_idle_monitors(DeflateMonitorCounters* c
 
 void ObjectSynchronizer::deflate_idle_monitors(DeflateMonitorCounters* counters) {
   assert(SafepointSynchronize::is_at_safepoint(), "must be at safepoint");
+  if (is_async_deflation_enabled()) {
+    // Leave it to the service thread, see is_async_deflation_needed().
+    AsyncDeflationSafepoint = 1;
+    return;
+  }
   bool deflated = false;
 
   ObjectMonitor * freeHeadp = NULL;  // Local SLL of scavenged monitors
@@ -2124,8 +2189,10 @@ void ObjectSynchronizer::finish_deflate_idle_monitors(DeflateMonitorCounters* co
 
   ForceMonitorScavenge = 0;    // Reset
 
-  OM_PERFDATA_OP(Deflations, inc(counters->nScavenged));
-  OM_PERFDATA_OP(MonExtant, set_value(counters->nInCirculation));
+  if (!is_async_deflation_enabled()) {
+    OM_PERFDATA_OP(Deflations, inc(counters->nScavenged));
+    OM_PERFDATA_OP(MonExtant, set_value(counters->nInCirculation));
+  }
 
   // TODO: Add objectMonitor leak detection.
   // Audit/inventory the objectMonitors -- make sure they're all accounted for.
@@ -2135,7 +2202,7 @@ void ObjectSynchronizer::finish_deflate_idle_monitors(DeflateMonitorCounters* co
 
 void ObjectSynchronizer::deflate_thread_local_monitors(Thread* thread, DeflateMonitorCounters* counters) {
   assert(SafepointSynchronize::is_at_safepoint(), "must be at safepoint");
-  if (!MonitorInUseLists) return;
+  if (!MonitorInUseLists || is_async_deflation_enabled()) return;
 
   ObjectMonitor * freeHeadp = NULL;  // Local SLL of scavenged monitors
   ObjectMonitor * freeTailp = NULL;
@@ -2165,6 +2232,234 @@ void ObjectSynchronizer::deflate_thread_local_monitors(Thread* thread, DeflateMo
   Thread::muxRelease(&gListLock);
 }
 
+// -----------------------------------------------------------------------------
+// Asynchronous deflation
+// ----------------------
+// With AsyncDeflateIdleMonitors the service thread deflates idle monitors
+// while the mutators keep running, so safepoint cleanup does not scale with
+// the monitor population anymore. A monitor is deflated in two steps:
+//
+//  1) The owner is set from NULL to DEFLATER_MARKER. From then on nobody can
+//     acquire the monitor, contending threads spin or block in enter().
+//  2) _count is set from 0 to -max_jint. enter() increments _count before a
+//     thread blocks, so either the deflater sees the contention and backs
+//     off, or the contending thread sees the negative count and retries
+//     with the restored object header.
+//
+// If either step fails, the owner is reset to NULL. The thread-local in-use
+// lists are walked in a handshake, which keeps their owners from changing
+// them. Threads that loaded a deflated monitor from the mark word before its
+// header was restored may still look at it, so deflated monitors are only
+// returned to the free list after a second handshake.
+//
+// So a thread that read a monitor from a mark word may find it:
+//  - in use: object() is the object and _count >= 0,
+//  - claimed by the deflater: _owner is DEFLATER_MARKER and _count >= 0,
+//    until step 2 either fails or succeeds,
+//  - deflated: _owner is DEFLATER_MARKER and _count is -max_jint. object() is
+//    the object until the header is restored, NULL after that.
+// A negative _count therefore implies the marker, and a NULL or different
+// object() a negative _count. inflate(), quick_enter() and
+// ObjectMonitor::enter() assert exactly that.
+
+bool ObjectSynchronizer::is_async_deflation_enabled() {
+  return AsyncDeflateIdleMonitors && MonitorInUseLists;
+}
+
+bool ObjectSynchronizer::is_async_deflation_needed() {
+  if (!is_async_deflation_enabled()) {
+    return false;
+  }
+  if (AsyncDeflationRequested != 0) {
+    return true;
+  }
+  if (os::javaTimeMillis() - LastAsyncDeflation < AsyncDeflationInterval) {
+    return false;
+  }
+  // Without async deflation idle monitors are deflated at every safepoint,
+  // whatever their usage. Keep deflating after safepoints, at most once per
+  // AsyncDeflationInterval. MonitorUsedDeflationThreshold covers the times
+  // without safepoints, as it does by inducing one otherwise.
+  if (AsyncDeflationSafepoint != 0) {
+    return true;
+  }
+  return MonitorUsedDeflationThreshold > 0 && monitors_used_above_threshold();
+}
+
+// Deflate a single monitor if not in-use, without a safepoint.
+// Return true if deflated, false if in-use
+bool ObjectSynchronizer::deflate_monitor_async(ObjectMonitor* mid, oop obj,
+                                               ObjectMonitor** freeHeadp,
+                                               ObjectMonitor** freeTailp) {
+  if (mid->is_busy()) {
+    return false;
+  }
+
+  if (Atomic::cmpxchg(ObjectMonitor::deflater_marker(), &mid->_owner, (void*)NULL) != NULL) {
+    // Entered since the is_busy() check.
+    return false;
+  }
+
+  if (mid->_waiters != 0 || mid->_cxq != NULL || mid->_EntryList != NULL ||
+      Atomic::cmpxchg(-max_jint, &mid->_count, (jint)0) != 0) {
+    // Some thread is about to block on the monitor, leave it alone.
+    OrderAccess::release_store(&mid->_owner, (void*)NULL);
+    return false;
+  }
+
+  // The monitor is ours. A hash code installed after the header is read
+  // here is detected by FastHashCode(), see wait_for_async_deflation().
+  markOop dmw = mid->header();
+  guarantee(dmw->is_neutral(), "invariant");
+  guarantee(obj->mark() == markOopDesc::encode(mid), "invariant");
+
+  if (log_is_enabled(Debug, monitorinflation)) {
+    if (obj->is_instance()) {
+      ResourceMark rm;
+      log_debug(monitorinflation)("Async deflating object " INTPTR_FORMAT " , "
+                                  "mark " INTPTR_FORMAT " , type %s",
+                                  p2i(obj), p2i(obj->mark()),
+                                  obj->klass()->external_name());
+    }
+  }
+
+  // Restore the header back to obj. The owner and count are reset
+  // when the monitor is returned to the free list.
+  obj->release_set_mark(dmw);
+  mid->set_object(NULL);
+
+  // Move the object to the working free list defined by freeHeadp, freeTailp
+  if (*freeHeadp == NULL) *freeHeadp = mid;
+  if (*freeTailp != NULL) {
+    ObjectMonitor * prevtail = *freeTailp;
+    assert(prevtail->FreeNext == NULL, "cleaned up deflated?");
+    prevtail->FreeNext = mid;
+  }
+  *freeTailp = mid;
+  return true;
+}
+
+// Deflates the monitors on the in-use list of each Java thread while the
+// thread is held in the handshake.
+class DeflateMonitorsClosure : public HandshakeClosure {
+ private:
+  DeflateMonitorCounters* _counters;
+  ObjectMonitor* _free_head;
+  ObjectMonitor* _free_tail;
+
+ public:
+  DeflateMonitorsClosure(DeflateMonitorCounters* counters) :
+    HandshakeClosure("DeflateMonitors"),
+    _counters(counters), _free_head(NULL), _free_tail(NULL) {}
+
+  ObjectMonitor* free_head() const { return _free_head; }
+  ObjectMonitor* free_tail() const { return _free_tail; }
+
+  // Called with gListLock held.
+  void add_deflated(ObjectMonitor* head, ObjectMonitor* tail) {
+    if (head == NULL) {
+      return;
+    }
+    assert(tail != NULL && tail->FreeNext == NULL, "invariant");
+    tail->FreeNext = _free_head;
+    _free_head = head;
+    if (_free_tail == NULL) {
+      _free_tail = tail;
+    }
+  }
+
+  void do_thread(Thread* thread) {
+    ObjectMonitor * freeHeadp = NULL;  // Local SLL of scavenged monitors
+    ObjectMonitor * freeTailp = NULL;
+
+    int deflated_count = ObjectSynchronizer::deflate_monitor_list(thread->omInUseList_addr(),
+                                                                  &freeHeadp, &freeTailp, true);
+
+    Thread::muxAcquire(&gListLock, "async deflation - handshake");
+    _counters->nInCirculation += thread->omInUseCount;
+    thread->omInUseCount -= deflated_count;
+    _counters->nScavenged += deflated_count;
+    _counters->nInuse += thread->omInUseCount;
+    add_deflated(freeHeadp, freeTailp);
+    Thread::muxRelease(&gListLock);
+  }
+};
+
+class AsyncDeflationSyncClosure : public HandshakeClosure {
+ public:
+  AsyncDeflationSyncClosure() : HandshakeClosure("AsyncDeflationSync") {}
+  void do_thread(Thread* thread) {}
+};
+
+void ObjectSynchronizer::deflate_idle_monitors_async() {
+  assert(Thread::current()->is_Java_thread(), "handshakes are executed by Java threads");
+  assert(is_async_deflation_enabled(), "sanity");
+  AsyncDeflationRequested = 0;
+  AsyncDeflationSafepoint = 0;
+
+  EventJavaMonitorDeflation event;
+  DeflateMonitorCounters counters;
+  prepare_deflate_idle_monitors(&counters);
+  DeflateMonitorsClosure deflate_cl(&counters);
+
+  // Monitors of moribund threads are only reachable from gOmInUseList,
+  // which is protected by gListLock.
+  Thread::muxAcquire(&gListLock, "async deflation - global");
+  if (gOmInUseList) {
+    ObjectMonitor * freeHeadp = NULL;
+    ObjectMonitor * freeTailp = NULL;
+    counters.nInCirculation += gOmInUseCount;
+    int deflated_count = deflate_monitor_list((ObjectMonitor **)&gOmInUseList, &freeHeadp, &freeTailp, true);
+    gOmInUseCount -= deflated_count;
+    counters.nScavenged += deflated_count;
+    counters.nInuse += gOmInUseCount;
+    deflate_cl.add_deflated(freeHeadp, freeTailp);
+  }
+  Thread::muxRelease(&gListLock);
+
+  // Non-Java threads rarely inflate and cannot take part in a handshake,
+  // their monitors are not deflated asynchronously.
+  Handshake::execute(&deflate_cl);
+
+  ObjectMonitor* head = deflate_cl.free_head();
+  if (head != NULL) {
+    AsyncDeflationSyncClosure sync_cl;
+    Handshake::execute(&sync_cl);
+
+    ObjectMonitor* tail = deflate_cl.free_tail();
+    for (ObjectMonitor* mid = head; mid != NULL; mid = mid->FreeNext) {
+      assert(mid->_owner == ObjectMonitor::deflater_marker(), "invariant");
+      assert(mid->is_being_async_deflated(), "invariant");
+      mid->_header = NULL;
+      mid->_count = 0;
+      mid->_owner = NULL;
+    }
+
+    Thread::muxAcquire(&gListLock, "async deflation - return");
+    // constant-time list splice - prepend scavenged segment to gFreeList
+    tail->FreeNext = gFreeList;
+    gFreeList = head;
+    gMonitorFreeCount += counters.nScavenged;
+    Thread::muxRelease(&gListLock);
+  }
+
+  LastAsyncDeflation = os::javaTimeMillis();
+
+  log_debug(monitorinflation)("Async deflation: in circulation=%d in use=%d deflated=%d "
+                              "population=%d free=%d",
+                              counters.nInCirculation, counters.nInuse, counters.nScavenged,
+                              gMonitorPopulation, gMonitorFreeCount);
+  OM_PERFDATA_OP(Deflations, inc(counters.nScavenged));
+  OM_PERFDATA_OP(MonExtant, set_value(counters.nInCirculation));
+
+  if (event.should_commit()) {
+    event.set_population(gMonitorPopulation);
+    event.set_inUse(counters.nInuse);
+    event.set_deflated(counters.nScavenged);
+    event.commit();
+  }
+}
+
 // Monitor cleanup on JavaThread::exit
 
 // Iterate through monitor cache and attempt to release thread's monitors
@@ -2217,6 +2512,60 @@ void ObjectSynchronizer::release_monitors_owned_by_thread(TRAPS) {
   THREAD->clear_pending_exception();
 }
 
+// Thread.contended_monitors support
+
+class CollectContendedMonitorsClosure : public MonitorClosure {
+ private:
+  GrowableArray<ObjectMonitor*>* _monitors;
+ public:
+  CollectContendedMonitorsClosure(GrowableArray<ObjectMonitor*>* monitors) : _monitors(monitors) {}
+  void do_monitor(ObjectMonitor* mid) {
+    ObjectMonitorContention* contention = mid->contention();
+    if (contention != NULL && contention->contended_enters() > 0) {
+      _monitors->append(mid);
+    }
+  }
+};
+
+static int compare_total_wait(ObjectMonitor** a, ObjectMonitor** b) {
+  jlong wait_a = (*a)->contention()->total_wait_nanos();
+  jlong wait_b = (*b)->contention()->total_wait_nanos();
+  return wait_a > wait_b ? -1 : (wait_a < wait_b ? 1 : 0);
+}
+
+void ObjectSynchronizer::print_contended_monitors(outputStream* st, int count) {
+  assert(SafepointSynchronize::is_at_safepoint(), "must be at safepoint");
+  if (!UseAdaptiveMonitorSpinning) {
+    st->print_cr("Monitor contention statistics require -XX:+UseAdaptiveMonitorSpinning");
+    return;
+  }
+
+  ResourceMark rm;
+  GrowableArray<ObjectMonitor*>* monitors = new GrowableArray<ObjectMonitor*>(64);
+  CollectContendedMonitorsClosure cl(monitors);
+  monitors_iterate(&cl);
+  monitors->sort(compare_total_wait);
+
+  ThreadsListHandle tlh;
+  st->print_cr("%d contended monitors, sorted by total wait time:", monitors->length());
+  for (int i = 0; i < monitors->length() && i < count; i++) {
+    ObjectMonitor* mid = monitors->at(i);
+    oop obj = (oop) mid->object();
+    st->print("\"%s\" object " INTPTR_FORMAT ", monitor " INTPTR_FORMAT,
+              obj->klass()->external_name(), p2i(obj), p2i(mid));
+    address owner = (address) mid->owner();
+    if (owner != NULL && !mid->is_owner_anonymous() &&
+        owner != (address) ObjectMonitor::DEFLATER_MARKER) {
+      JavaThread* owner_thread = Threads::owning_thread_from_monitor_owner(tlh.list(), owner);
+      if (owner_thread != NULL) {
+        st->print(", owned by \"%s\"", owner_thread->get_thread_name());
+      }
+    }
+    st->cr();
+    mid->contention()->print_on(st);
+  }
+}
+
 const char* ObjectSynchronizer::inflate_cause_name(const InflateCause cause) {
   switch (cause) {
     case inflate_cause_vm_internal:    return "VM Internal";
@@ -2226,6 +2575,7 @@ const char* ObjectSynchronizer::inflate_cause_name(const InflateCause cause) {
     case inflate_cause_hash_code:      return "Monitor Hash Code";
     case inflate_cause_jni_enter:      return "JNI Monitor Enter";
     case inflate_cause_jni_exit:       return "JNI Monitor Exit";
+    case inflate_cause_lock_stack_full: return "Lock Stack Full";
     default:
       ShouldNotReachHere();
   }
@@ -57,7 +57,8 @@ class ObjectSynchronizer : AllStatic {
     inflate_cause_hash_code = 4,
     inflate_cause_jni_enter = 5,
     inflate_cause_jni_exit = 6,
-    inflate_cause_nof = 7 // Number of causes
+    inflate_cause_lock_stack_full = 7,
+    inflate_cause_nof = 8 // Number of causes
   } InflateCause;
 
   // exit must be implemented non-blocking, since the compiler cannot easily handle
@@ -134,6 +135,10 @@ class ObjectSynchronizer : AllStatic {
   static void release_monitors_owned_by_thread(TRAPS);
   static void monitors_iterate(MonitorClosure* m);
 
+  // Thread.contended_monitors: print the contention statistics of the
+  // count most contended monitors (UseAdaptiveMonitorSpinning)
+  static void print_contended_monitors(outputStream* st, int count);
+
   // GC: we current use aggressive monitor deflation policy
   // Basically we deflate all monitors that are not busy.
   // An adaptive profile-based deflation policy could be used if needed
@@ -145,10 +150,20 @@ class ObjectSynchronizer : AllStatic {
   // For a given monitor list: global or per-thread, deflate idle monitors
   static int deflate_monitor_list(ObjectMonitor** listheadp,
                                   ObjectMonitor** freeHeadp,
-                                  ObjectMonitor** freeTailp);
+                                  ObjectMonitor** freeTailp,
+                                  bool async = false);
   static bool deflate_monitor(ObjectMonitor* mid, oop obj,
                               ObjectMonitor** freeHeadp,
                               ObjectMonitor** freeTailp);
+
+  // AsyncDeflateIdleMonitors: deflation by the service thread, outside
+  // of safepoints
+  static bool is_async_deflation_enabled();
+  static bool is_async_deflation_needed();
+  static void deflate_idle_monitors_async();
+  static bool deflate_monitor_async(ObjectMonitor* mid, oop obj,
+                                    ObjectMonitor** freeHeadp,
+                                    ObjectMonitor** freeTailp);
   static bool is_cleanup_needed();
   static void oops_do(OopClosure* f);
   // Process oops in thread local used monitors
@@ -1349,6 +1349,10 @@ class JavaThread: public Thread {
     _handshake.set_operation(this, op);
   }
 
+  void queue_async_handshake(AsyncHandshakeClosure* cl) {
+    _handshake.add_async_operation(this, cl);
+  }
+
   bool has_handshake() const {
     return _handshake.has_operation();
   }
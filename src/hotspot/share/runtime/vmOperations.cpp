@@ -38,6 +38,7 @@
 #include "runtime/frame.inline.hpp"
 #include "runtime/interfaceSupport.inline.hpp"
 #include "runtime/sweeper.hpp"
+#include "runtime/synchronizer.hpp"
 #include "runtime/thread.inline.hpp"
 #include "runtime/threadSMR.inline.hpp"
 #include "runtime/vmOperations.hpp"
@@ -226,6 +227,10 @@ void VM_PrintJNI::doit() {
   JNIHandles::print_on(_out);
 }
 
+void VM_PrintContendedMonitors::doit() {
+  ObjectSynchronizer::print_contended_monitors(_out, _count);
+}
+
 void VM_PrintMetadata::doit() {
   MetaspaceUtils::print_report(_out, _scale, _flags);
 }
@@ -62,6 +62,7 @@
   template(UnlinkSymbols)                         \
   template(Verify)                                \
   template(PrintJNI)                              \
+  template(PrintContendedMonitors)                \
   template(HeapDumper)                            \
   template(HeapDumpMerge)                         \
   template(DeoptimizeTheWorld)                    \
@@ -416,6 +417,16 @@ class VM_PrintJNI: public VM_Operation {
   void doit();
 };
 
+class VM_PrintContendedMonitors: public VM_Operation {
+ private:
+  outputStream* _out;
+  int _count;
+ public:
+  VM_PrintContendedMonitors(outputStream* out, int count) : _out(out), _count(count) {}
+  VMOp_Type type() const                { return VMOp_PrintContendedMonitors; }
+  void doit();
+};
+
 class VM_PrintMetadata : public VM_Operation {
  private:
   outputStream* const _out;
@@ -30,6 +30,7 @@
 #include "compiler/compileBroker.hpp"
 #include "compiler/directivesParser.hpp"
 #include "gc/shared/vmGCOperations.hpp"
+#include "interpreter/bytecodeSampler.hpp"
 #include "memory/metaspace/metaspaceDCmd.hpp"
 #include "memory/resourceArea.hpp"
 #include "oops/objArrayOop.inline.hpp"
@@ -110,6 +111,8 @@ void DCmdRegistrant::register_dcmds(){
   DCmdFactory::register_DCmdFactory(new DCmdFactoryImpl<JVMTIDataDumpDCmd>(full_export, true, false));
 #endif // INCLUDE_JVMTI
   DCmdFactory::register_DCmdFactory(new DCmdFactoryImpl<ThreadDumpDCmd>(full_export, true, false));
+  DCmdFactory::register_DCmdFactory(new DCmdFactoryImpl<ContendedMonitorsDCmd>(full_export, true, false));
+  DCmdFactory::register_DCmdFactory(new DCmdFactoryImpl<BytecodeSamplesDCmd>(full_export, true, false));
   DCmdFactory::register_DCmdFactory(new DCmdFactoryImpl<ClassLoaderStatsDCmd>(full_export, true, false));
   DCmdFactory::register_DCmdFactory(new DCmdFactoryImpl<ClassLoaderHierarchyDCmd>(full_export, true, false));
   DCmdFactory::register_DCmdFactory(new DCmdFactoryImpl<CompileQueueDCmd>(full_export, true, false));
@@ -121,6 +124,7 @@ void DCmdRegistrant::register_dcmds(){
 #endif // LINUX
   DCmdFactory::register_DCmdFactory(new DCmdFactoryImpl<TouchedMethodsDCmd>(full_export, true, false));
   DCmdFactory::register_DCmdFactory(new DCmdFactoryImpl<CodeHeapAnalyticsDCmd>(full_export, true, false));
+  DCmdFactory::register_DCmdFactory(new DCmdFactoryImpl<CompilerReplayCaptureDCmd>(full_export, true, false));
 
   DCmdFactory::register_DCmdFactory(new DCmdFactoryImpl<CompilerDirectivesPrintDCmd>(full_export, true, false));
   DCmdFactory::register_DCmdFactory(new DCmdFactoryImpl<CompilerDirectivesAddDCmd>(full_export, true, false));
@@ -705,6 +709,62 @@ int ThreadDumpDCmd::num_arguments() {
   }
 }
 
+ContendedMonitorsDCmd::ContendedMonitorsDCmd(outputStream* output, bool heap) :
+                                             DCmdWithParser(output, heap),
+  _count("-n", "Number of monitors to print", "INT", false, "10") {
+  _dcmdparser.add_dcmd_option(&_count);
+}
+
+void ContendedMonitorsDCmd::execute(DCmdSource source, TRAPS) {
+  if (_count.value() < 0) {
+    THROW_MSG(vmSymbols::java_lang_IllegalArgumentException(),
+              "Number of monitors must be non-negative");
+  }
+  VM_PrintContendedMonitors op(output(), (int) MIN2(_count.value(), (jlong) max_jint));
+  VMThread::execute(&op);
+}
+
+int ContendedMonitorsDCmd::num_arguments() {
+  ResourceMark rm;
+  ContendedMonitorsDCmd* dcmd = new ContendedMonitorsDCmd(NULL, false);
+  if (dcmd != NULL) {
+    DCmdMark mark(dcmd);
+    return dcmd->_dcmdparser.num_arguments();
+  } else {
+    return 0;
+  }
+}
+
+BytecodeSamplesDCmd::BytecodeSamplesDCmd(outputStream* output, bool heap) :
+                                         DCmdWithParser(output, heap),
+  _count("-n", "Number of bytecodes to print", "INT", false, "20"),
+  _reset("-reset", "Discard the samples after printing them", "BOOLEAN", false, "false") {
+  _dcmdparser.add_dcmd_option(&_count);
+  _dcmdparser.add_dcmd_option(&_reset);
+}
+
+void BytecodeSamplesDCmd::execute(DCmdSource source, TRAPS) {
+  if (_count.value() < 0) {
+    THROW_MSG(vmSymbols::java_lang_IllegalArgumentException(),
+              "Number of bytecodes must be non-negative");
+  }
+  BytecodeSampler::print_on(output(), (int) MIN2(_count.value(), (jlong) max_jint));
+  if (_reset.value()) {
+    BytecodeSampler::reset();
+  }
+}
+
+int BytecodeSamplesDCmd::num_arguments() {
+  ResourceMark rm;
+  BytecodeSamplesDCmd* dcmd = new BytecodeSamplesDCmd(NULL, false);
+  if (dcmd != NULL) {
+    DCmdMark mark(dcmd);
+    return dcmd->_dcmdparser.num_arguments();
+  } else {
+    return 0;
+  }
+}
+
 // Enhanced JMX Agent support
 
 JMXStartRemoteDCmd::JMXStartRemoteDCmd(outputStream *output, bool heap_allocated) :
@@ -1032,6 +1092,33 @@ int CodeHeapAnalyticsDCmd::num_arguments() {
     return 0;
   }
 }
+
+CompilerReplayCaptureDCmd::CompilerReplayCaptureDCmd(outputStream* output, bool heap) :
+                                                     DCmdWithParser(output, heap),
+  _filename("filename", "Name of the replay archive", "STRING", false, "replay_archive.log"),
+  _stop("-stop", "Stop capturing and close the archive", "BOOLEAN", false, "false") {
+  _dcmdparser.add_dcmd_option(&_stop);
+  _dcmdparser.add_dcmd_argument(&_filename);
+}
+
+void CompilerReplayCaptureDCmd::execute(DCmdSource source, TRAPS) {
+  if (_stop.value()) {
+    CompileBroker::stop_replay_capture(output());
+  } else {
+    CompileBroker::start_replay_capture(_filename.value(), output());
+  }
+}
+
+int CompilerReplayCaptureDCmd::num_arguments() {
+  ResourceMark rm;
+  CompilerReplayCaptureDCmd* dcmd = new CompilerReplayCaptureDCmd(NULL, false);
+  if (dcmd != NULL) {
+    DCmdMark mark(dcmd);
+    return dcmd->_dcmdparser.num_arguments();
+  } else {
+    return 0;
+  }
+}
 //---<  END  >--- CodeHeap State Analytics.
 
 void CompilerDirectivesPrintDCmd::execute(DCmdSource source, TRAPS) {
@@ -469,6 +469,51 @@ public:
   virtual void execute(DCmdSource source, TRAPS);
 };
 
+class ContendedMonitorsDCmd : public DCmdWithParser {
+protected:
+  DCmdArgument<jlong> _count;
+public:
+  ContendedMonitorsDCmd(outputStream* output, bool heap);
+  static const char* name() { return "Thread.contended_monitors"; }
+  static const char* description() {
+    return "Print the most contended Java monitors with their wait and hold time "
+           "histograms. Requires -XX:+UseAdaptiveMonitorSpinning.";
+  }
+  static const char* impact() {
+    return "Medium: Depends on the number of inflated monitors.";
+  }
+  static const JavaPermission permission() {
+    JavaPermission p = {"java.lang.management.ManagementPermission",
+                        "monitor", NULL};
+    return p;
+  }
+  static int num_arguments();
+  virtual void execute(DCmdSource source, TRAPS);
+};
+
+class BytecodeSamplesDCmd : public DCmdWithParser {
+protected:
+  DCmdArgument<jlong> _count;
+  DCmdArgument<bool>  _reset;
+public:
+  BytecodeSamplesDCmd(outputStream* output, bool heap);
+  static const char* name() { return "Interpreter.bytecode_samples"; }
+  static const char* description() {
+    return "Print the bytecodes most often sampled in interpreted methods. "
+           "Requires -XX:BytecodeSamplingInterval.";
+  }
+  static const char* impact() {
+    return "Low";
+  }
+  static const JavaPermission permission() {
+    JavaPermission p = {"java.lang.management.ManagementPermission",
+                        "monitor", NULL};
+    return p;
+  }
+  static int num_arguments();
+  virtual void execute(DCmdSource source, TRAPS);
+};
+
 // Enhanced JMX Agent support
 
 class JMXStartRemoteDCmd : public DCmdWithParser {
@@ -695,6 +740,31 @@ public:
 };
 //---<  END  >--- CodeHeap State Analytics.
 
+class CompilerReplayCaptureDCmd : public DCmdWithParser {
+protected:
+  DCmdArgument<char*> _filename;
+  DCmdArgument<bool>  _stop;
+public:
+  CompilerReplayCaptureDCmd(outputStream* output, bool heap);
+  static const char* name() {
+    return "Compiler.replay_capture";
+  }
+  static const char* description() {
+    return "Capture the replay data of all following compilations into one archive, "
+           "or stop capturing.";
+  }
+  static const char* impact() {
+    return "Medium: Every compilation writes its replay data to the archive.";
+  }
+  static const JavaPermission permission() {
+    JavaPermission p = {"java.lang.management.ManagementPermission",
+                        "monitor", NULL};
+    return p;
+  }
+  static int num_arguments();
+  virtual void execute(DCmdSource source, TRAPS);
+};
+
 class CompilerDirectivesPrintDCmd : public DCmd {
 public:
   CompilerDirectivesPrintDCmd(outputStream* output, bool heap) : DCmd(output, heap) {}
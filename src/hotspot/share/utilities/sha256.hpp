@@ -0,0 +1,61 @@
+/*
+ * Copyright (c) 2026, Alibaba Group Holding Limited. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+#ifndef SHARE_VM_UTILITIES_SHA256_HPP
+#define SHARE_VM_UTILITIES_SHA256_HPP
+
+#include "memory/allocation.hpp"
+
+// SHA-256 (FIPS 180-4) of a byte sequence, for comparing data the VM got
+// from untrusted sources with data it accepted earlier.
+class SHA256 : public StackObj {
+ public:
+  enum {
+    digest_length = 32,
+    block_length  = 64
+  };
+
+ private:
+  uint32_t _state[8];
+  u1       _block[block_length];
+  size_t   _block_used;
+  uint64_t _total_length;
+
+  void process_block(const u1* block);
+
+ public:
+  SHA256();
+
+  void update(const u1* data, size_t length);
+  // Writes the digest of the data passed to update(). The object cannot be
+  // updated afterwards.
+  void finish(u1 digest[digest_length]);
+
+  static void digest(const u1* data, size_t length, u1 digest[digest_length]) {
+    SHA256 sha;
+    sha.update(data, length);
+    sha.finish(digest);
+  }
+};
+
+#endif // SHARE_VM_UTILITIES_SHA256_HPP
@@ -0,0 +1,205 @@
+/*
+ * Copyright (c) 2026, Alibaba Group Holding Limited. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+package com.sun.hotspot.tools.replay;
+
+import java.io.BufferedReader;
+import java.io.IOException;
+import java.io.InputStreamReader;
+import java.io.PrintStream;
+import java.io.PrintWriter;
+import java.nio.file.Files;
+import java.nio.file.Path;
+import java.nio.file.Paths;
+import java.util.ArrayList;
+import java.util.List;
+import java.util.concurrent.ExecutorService;
+import java.util.concurrent.Executors;
+import java.util.concurrent.Future;
+
+/**
+ * Replays all compilations of a replay archive and reports the compile time,
+ * arena memory and code size of each of them.
+ *
+ * The archive is written by a VM running with -XX:ReplayCaptureFile=<file>
+ * or after "jcmd <pid> Compiler.replay_capture <file>". Every record is
+ * replayed in its own debug VM (-XX:+ReplayCompiles), several VMs in
+ * parallel. The replay VMs need the class path of the captured application.
+ *
+ * Usage: java -jar replay.jar [options] archive
+ *   -java <launcher>   java launcher of the debug VM to replay with (default: java)
+ *   -cp <class path>   class path of the captured application
+ *   -j <n>             number of replay VMs to run in parallel (default: #cpus)
+ *   -J<vm option>      additional option for the replay VMs
+ *
+ * Prints one line per record:
+ *   compile_id comp_level osr_bci time_us arena_bytes insts_size total_size method
+ * followed by the totals. Failed replays print FAILED instead of the numbers.
+ */
+public class ReplayCompiles {
+    static final String RECORD_START = "# replay_record ";
+    static final String RECORD_END = "# end_replay_record";
+
+    static class Record {
+        final String header;
+        final Path file;
+        String result;
+        Record(String header, Path file) {
+            this.header = header;
+            this.file = file;
+        }
+    }
+
+    static void usage(PrintStream out) {
+        out.println("Usage: java -jar replay.jar [-java <launcher>] [-cp <class path>] [-j <n>] [-J<vm option>]... archive");
+        System.exit(1);
+    }
+
+    public static void main(String[] args) throws Exception {
+        String java = "java";
+        String classPath = null;
+        int jobs = Runtime.getRuntime().availableProcessors();
+        List<String> vmOptions = new ArrayList<>();
+        String archive = null;
+        for (int i = 0; i < args.length; i++) {
+            String arg = args[i];
+            if (arg.equals("-java") && i + 1 < args.length) {
+                java = args[++i];
+            } else if (arg.equals("-cp") && i + 1 < args.length) {
+                classPath = args[++i];
+            } else if (arg.equals("-j") && i + 1 < args.length) {
+                jobs = Integer.parseInt(args[++i]);
+            } else if (arg.startsWith("-J")) {
+                vmOptions.add(arg.substring(2));
+            } else if (archive == null && !arg.startsWith("-")) {
+                archive = arg;
+            } else {
+                usage(System.err);
+            }
+        }
+        if (archive == null || jobs < 1) {
+            usage(System.err);
+        }
+
+        Path dir = Files.createTempDirectory("replay");
+        List<Record> records = split(Paths.get(archive), dir);
+
+        ExecutorService pool = Executors.newFixedThreadPool(jobs);
+        List<Future<?>> futures = new ArrayList<>();
+        for (Record r : records) {
+            List<String> cmd = new ArrayList<>();
+            cmd.add(java);
+            cmd.addAll(vmOptions);
+            if (classPath != null) {
+                cmd.add("-cp");
+                cmd.add(classPath);
+            }
+            cmd.add("-XX:+ReplayCompiles");
+            cmd.add("-XX:+ReplayIgnoreInitErrors");
+            cmd.add("-XX:ReplayDataFile=" + r.file);
+            futures.add(pool.submit(() -> {
+                r.result = replay(cmd);
+                return null;
+            }));
+        }
+        for (Future<?> f : futures) {
+            f.get();
+        }
+        pool.shutdown();
+
+        long time = 0, arena = 0, insts = 0, total = 0;
+        int failed = 0;
+        System.out.println("compile_id comp_level osr_bci time_us arena_bytes insts_size total_size method");
+        for (Record r : records) {
+            String[] result = r.result == null ? null : r.result.split(" ");
+            // ReplayResult <method> <entry_bci> <comp_level> time_us=# arena_bytes=# insts_size=# total_size=#
+            if (result == null || result.length != 8 || value(result[6]) < 0) {
+                failed++;
+                System.out.println(r.header + " FAILED " + (result != null && result.length > 1 ? result[1] : ""));
+                continue;
+            }
+            long t = value(result[4]), a = value(result[5]), i = value(result[6]), s = value(result[7]);
+            time += t;
+            arena += a;
+            insts += i;
+            total += s;
+            System.out.println(r.header + " " + t + " " + a + " " + i + " " + s + " " + result[1]);
+        }
+        System.out.println("total: " + records.size() + " compilations, " + failed + " failed, time_us=" + time +
+                           " arena_bytes=" + arena + " insts_size=" + insts + " total_size=" + total);
+
+        for (Record r : records) {
+            Files.deleteIfExists(r.file);
+        }
+        Files.deleteIfExists(dir);
+    }
+
+    // Split the archive into one replay file per record.
+    static List<Record> split(Path archive, Path dir) throws IOException {
+        List<Record> records = new ArrayList<>();
+        try (BufferedReader in = Files.newBufferedReader(archive)) {
+            PrintWriter out = null;
+            String line;
+            while ((line = in.readLine()) != null) {
+                if (line.startsWith(RECORD_START)) {
+                    Path file = dir.resolve("replay_" + records.size() + ".log");
+                    records.add(new Record(line.substring(RECORD_START.length()), file));
+                    out = new PrintWriter(Files.newBufferedWriter(file));
+                } else if (line.equals(RECORD_END)) {
+                    if (out != null) {
+                        out.close();
+                        out = null;
+                    }
+                } else if (out != null) {
+                    out.println(line);
+                }
+            }
+            if (out != null) {
+                // Truncated last record, e.g. the VM died while capturing
+                out.close();
+                Files.delete(records.remove(records.size() - 1).file);
+            }
+        }
+        return records;
+    }
+
+    // Run one replay VM and return its ReplayResult line, or null.
+    static String replay(List<String> cmd) throws IOException, InterruptedException {
+        Process p = new ProcessBuilder(cmd).redirectErrorStream(true).start();
+        String result = null;
+        try (BufferedReader in = new BufferedReader(new InputStreamReader(p.getInputStream()))) {
+            String line;
+            while ((line = in.readLine()) != null) {
+                if (line.startsWith("ReplayResult ")) {
+                    result = line;
+                }
+            }
+        }
+        p.waitFor();
+        return result;
+    }
+
+    static long value(String field) {
+        return Long.parseLong(field.substring(field.indexOf('=') + 1));
+    }
+}
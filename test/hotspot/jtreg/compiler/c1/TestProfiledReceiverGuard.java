@@ -0,0 +1,107 @@
+/*
+ * Copyright (c) 2026, Alibaba Group Holding Limited. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+/*
+ * @test
+ * @summary a failed profiled receiver guard in C1 code is recorded, so the
+ *          recompiled method doesn't speculate on that call site again
+ * @requires vm.compiler1.enabled & vm.compiler2.enabled
+ * @library /test/lib
+ * @build sun.hotspot.WhiteBox
+ * @run driver ClassFileInstaller sun.hotspot.WhiteBox
+ *                              sun.hotspot.WhiteBox$WhiteBoxPermission
+ * @run main/othervm -Xbootclasspath/a:. -XX:+UnlockDiagnosticVMOptions -XX:+WhiteBoxAPI
+ *                   -Xbatch -XX:TieredStopAtLevel=1 -XX:TypeProfileWidth=1
+ *                   -XX:+C1ProfileGuidedInlining -XX:C1ProfileGuidedInliningMinCount=100
+ *                   -XX:CompileCommand=compileonly,compiler.c1.TestProfiledReceiverGuard::caller
+ *                   compiler.c1.TestProfiledReceiverGuard
+ */
+
+package compiler.c1;
+
+import java.lang.reflect.Method;
+
+import sun.hotspot.WhiteBox;
+
+public class TestProfiledReceiverGuard {
+    static final WhiteBox WB = WhiteBox.getWhiteBox();
+
+    static abstract class Shape {
+        abstract int sides();
+    }
+
+    static class Triangle extends Shape {
+        int sides() { return 3; }
+    }
+
+    static class Square extends Shape {
+        int sides() { return 4; }
+    }
+
+    static int caller(Shape s) {
+        return s.sides();
+    }
+
+    static void compile(Method m) {
+        WB.deoptimizeMethod(m);
+        if (!WB.enqueueMethodForCompilation(m, 1) || !WB.isMethodCompiled(m)) {
+            throw new RuntimeException("caller was not compiled");
+        }
+    }
+
+    public static void main(String[] args) throws Exception {
+        Method m = TestProfiledReceiverGuard.class.getDeclaredMethod("caller", Shape.class);
+        Shape triangle = new Triangle();
+        Shape square = new Square();  // two subclasses: CHA can't bind the call
+
+        // Only Triangle receivers in the profile.
+        WB.markMethodProfiled(m);
+        for (int i = 0; i < 1_000; i++) {
+            caller(triangle);
+        }
+
+        compile(m);
+        if (caller(triangle) != 3) {
+            throw new RuntimeException("wrong result for Triangle");
+        }
+        if (!WB.isMethodCompiled(m)) {
+            throw new RuntimeException("the profiled receiver must pass the guard");
+        }
+        if (caller(square) != 4) {
+            throw new RuntimeException("wrong result for Square");
+        }
+        if (WB.isMethodCompiled(m)) {
+            throw new RuntimeException("a failed guard must deoptimize and make caller not entrant");
+        }
+
+        // With TypeProfileWidth=1 the profile still has the single Triangle
+        // row, only the recorded trap keeps C1 from speculating again.
+        compile(m);
+        if (caller(square) != 4 || caller(triangle) != 3) {
+            throw new RuntimeException("wrong result after recompilation");
+        }
+        if (!WB.isMethodCompiled(m)) {
+            throw new RuntimeException("caller speculated again on a call site with a recorded trap");
+        }
+    }
+}
@@ -0,0 +1,59 @@
+/*
+ * Copyright (c) 2026, Alibaba Group Holding Limited. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+/*
+ * @test
+ * @summary replay data of all compilations is captured into one archive
+ * @library /test/lib
+ * @run driver compiler.ciReplay.TestReplayCapture
+ */
+
+package compiler.ciReplay;
+
+import java.nio.file.Files;
+import java.nio.file.Paths;
+import java.util.List;
+
+import jdk.test.lib.Asserts;
+import jdk.test.lib.process.OutputAnalyzer;
+import jdk.test.lib.process.ProcessTools;
+
+public class TestReplayCapture {
+    public static void main(String[] args) throws Exception {
+        String archive = "replay_archive_" + ProcessHandle.current().pid() + ".log";
+        ProcessBuilder pb = ProcessTools.createJavaProcessBuilder(
+            "-XX:ReplayCaptureFile=" + archive, "-Xlog:jit+compilation=info", "-Xcomp",
+            "-XX:CompileOnly=java.lang.String::hashCode", "-version");
+        OutputAnalyzer out = new OutputAnalyzer(pb.start());
+        out.shouldHaveExitValue(0);
+        out.shouldContain("Capturing compiler replay data into " + archive);
+
+        List<String> lines = Files.readAllLines(Paths.get(archive));
+        long starts = lines.stream().filter(l -> l.startsWith("# replay_record ")).count();
+        long ends = lines.stream().filter(l -> l.equals("# end_replay_record")).count();
+        long compiles = lines.stream().filter(l -> l.startsWith("compile java/lang/String hashCode ")).count();
+        Asserts.assertGT(starts, 0L, "no replay records captured");
+        Asserts.assertEQ(starts, ends, "unterminated replay record");
+        Asserts.assertEQ(starts, compiles, "replay record without compile command");
+    }
+}
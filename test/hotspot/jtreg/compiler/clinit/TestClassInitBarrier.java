@@ -0,0 +1,134 @@
+/*
+ * Copyright (c) 2026, Alibaba Group Holding Limited. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+/*
+ * @test
+ * @summary access statics of a class in <clinit> from compiled code, check other threads wait for the initialization
+ *          and the code is not deoptimized once the class is initialized
+ * @requires vm.compiler2.enabled
+ * @library /test/lib
+ * @modules java.base/jdk.internal.misc
+ *          java.management
+ * @build sun.hotspot.WhiteBox
+ * @run driver ClassFileInstaller sun.hotspot.WhiteBox sun.hotspot.WhiteBox$WhiteBoxPermission
+ * @run driver compiler.clinit.TestClassInitBarrier
+ */
+
+package compiler.clinit;
+
+import java.io.File;
+import java.lang.reflect.Method;
+import java.nio.file.Files;
+import java.nio.file.Paths;
+
+import jdk.test.lib.process.OutputAnalyzer;
+import jdk.test.lib.process.ProcessTools;
+import sun.hotspot.WhiteBox;
+
+public class TestClassInitBarrier {
+    static volatile int seen = -1;
+
+    static class Holder {
+        static int value;
+
+        static {
+            Thread reader = new Thread(() -> seen = Holder.get());
+            reader.start();
+            // Get get() compiled while Holder is being initialized.
+            int sum = 0;
+            for (int i = 0; i < 100_000; i++) {
+                sum += get();
+            }
+            value = 42 + sum;
+        }
+
+        static int get() {
+            return value;
+        }
+    }
+
+    // Runs in a VM started by main()
+    public static class Payload {
+        public static void main(String[] args) throws Exception {
+            boolean barriers = args[0].equals("barriers");
+            int value = Holder.get();
+            if (value != 42) {
+                throw new RuntimeException("Holder.get() returned " + value);
+            }
+            while (seen == -1) {
+                Thread.sleep(10);
+            }
+            if (seen != 42) {
+                throw new RuntimeException("reader saw " + seen + " before Holder was initialized");
+            }
+            // The code compiled in <clinit> is still in use
+            Method get = Holder.class.getDeclaredMethod("get");
+            if (barriers && !WhiteBox.getWhiteBox().isMethodCompiled(get)) {
+                throw new RuntimeException("Holder.get() was deoptimized");
+            }
+        }
+    }
+
+    static String run(boolean barriers) throws Exception {
+        String log = "clinit-" + (barriers ? "barriers" : "traps") + ".log";
+        new File(log).delete();
+        ProcessBuilder pb = ProcessTools.createJavaProcessBuilder(true,
+            "-Xbootclasspath/a:.",
+            "-XX:+UnlockDiagnosticVMOptions",
+            "-XX:+WhiteBoxAPI",
+            "-Xbatch",
+            "-XX:-TieredCompilation",
+            (barriers ? "-XX:+" : "-XX:-") + "ClassInitBarriers",
+            "-XX:CompileCommand=compileonly," + Holder.class.getName() + "::get",
+            "-XX:+LogCompilation",
+            "-XX:LogFile=" + log,
+            Payload.class.getName(),
+            barriers ? "barriers" : "traps");
+        OutputAnalyzer output = new OutputAnalyzer(pb.start());
+        output.shouldHaveExitValue(0);
+        return new String(Files.readAllBytes(Paths.get(log)));
+    }
+
+    public static void main(String[] args) throws Exception {
+        // Uncommon traps are logged as <uncommon_trap thread=... reason='uninitialized' ...>
+        String trap = "<uncommon_trap thread=";
+        String uninitialized = "reason='uninitialized'";
+
+        String log = run(true);
+        for (String line : log.split("\n")) {
+            if (line.contains(trap) && line.contains(uninitialized)) {
+                throw new RuntimeException("Deoptimized with the barriers: " + line);
+            }
+        }
+
+        // Without the barriers the same code is deoptimized, so the check
+        // above would catch their absence.
+        log = run(false);
+        boolean trapped = false;
+        for (String line : log.split("\n")) {
+            trapped |= line.contains(trap) && line.contains(uninitialized);
+        }
+        if (!trapped) {
+            throw new RuntimeException("No uninitialized trap without the barriers");
+        }
+    }
+}
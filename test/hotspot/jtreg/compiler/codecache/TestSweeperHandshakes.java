@@ -0,0 +1,67 @@
+/*
+ * Copyright (c) 2026, Alibaba Group Holding Limited. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+/*
+ * @test
+ * @summary sweep a small, churning code cache with handshake stack scanning and defragmentation
+ * @library /test/lib
+ * @run main/othervm -XX:ReservedCodeCacheSize=16m -XX:+SweeperUseHandshakes
+ *                   -XX:+CodeCacheDefragmentation -XX:CodeCacheDefragmentationThreshold=10
+ *                   compiler.codecache.TestSweeperHandshakes
+ * @run main/othervm -XX:ReservedCodeCacheSize=16m -XX:+SweeperUseHandshakes -XX:-TieredCompilation
+ *                   compiler.codecache.TestSweeperHandshakes
+ */
+
+package compiler.codecache;
+
+import java.lang.reflect.Method;
+import java.net.URL;
+import java.net.URLClassLoader;
+
+public class TestSweeperHandshakes {
+    public static class Worker {
+        public static long work(long n) {
+            long sum = 0;
+            for (long i = 0; i < n; i++) {
+                sum += i ^ (sum >>> 3);
+            }
+            return sum;
+        }
+    }
+
+    public static void main(String[] args) throws Exception {
+        URL[] urls = { TestSweeperHandshakes.class.getProtectionDomain().getCodeSource().getLocation() };
+        for (int round = 0; round < 200; round++) {
+            // Each loader gets its own copy of Worker and so its own nmethods,
+            // which are unloaded and swept once the loader is gone.
+            ClassLoader loader = new URLClassLoader(urls, null);
+            Method work = loader.loadClass(Worker.class.getName()).getMethod("work", long.class);
+            for (int i = 0; i < 2_000; i++) {
+                work.invoke(null, 100L);
+            }
+            if (round % 20 == 0) {
+                System.gc();
+            }
+        }
+    }
+}
@@ -0,0 +1,87 @@
+/*
+ * Copyright (c) 2026, Alibaba Group Holding Limited. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+/*
+ * @test
+ * @summary fields placed in gaps of the superclass layout must survive scalar
+ *          replacement and reallocation at deoptimization
+ * @requires vm.compiler2.enabled
+ * @modules java.base/jdk.internal.misc
+ * @run main/othervm -XX:+CompactFieldsInSuperGaps -XX:-TieredCompilation
+ *                   -XX:-BackgroundCompilation -XX:-UseOnStackReplacement
+ *                   -XX:CompileCommand=compileonly,compiler.escapeAnalysis.TestScalarReplaceGapFields::test
+ *                   compiler.escapeAnalysis.TestScalarReplaceGapFields
+ */
+
+package compiler.escapeAnalysis;
+
+import jdk.internal.misc.Unsafe;
+
+public class TestScalarReplaceGapFields {
+    static class Base {
+        long l;
+        byte a;
+    }
+
+    // Both fields fit in the gap after Base.a, so Sub is no larger than Base.
+    static class Sub extends Base {
+        byte b;
+        short s;
+    }
+
+    static long test(byte x, short y, boolean deopt) {
+        Sub o = new Sub();
+        o.l = 42;
+        o.a = x;
+        o.b = (byte)(x + 1);
+        o.s = y;
+        if (deopt) {
+            // Never taken while warming up: an uncommon trap that has to
+            // reallocate the scalar replaced o with all of its fields.
+            return o.l * 1_000_000_000L + o.a * 1_000_000L + o.b * 1_000L + o.s;
+        }
+        o.s++;
+        return o.a + o.b + o.s;
+    }
+
+    public static void main(String[] args) {
+        Unsafe unsafe = Unsafe.getUnsafe();
+        long end = unsafe.objectFieldOffset(Base.class, "a") + 1;
+        if (unsafe.objectFieldOffset(Sub.class, "b") >= end + 8 ||
+            unsafe.objectFieldOffset(Sub.class, "s") >= end + 8) {
+            throw new RuntimeException("Sub fields are not placed in the gap of Base");
+        }
+
+        for (int i = 0; i < 20_000; i++) {
+            long r = test((byte)3, (short)7, false);
+            if (r != 3 + 4 + 8) {
+                throw new RuntimeException("wrong result " + r);
+            }
+        }
+        long r = test((byte)3, (short)7, true);
+        long expected = 42L * 1_000_000_000L + 3 * 1_000_000L + 4 * 1_000L + 7;
+        if (r != expected) {
+            throw new RuntimeException("fields lost at deoptimization: " + r + ", expected " + expected);
+        }
+    }
+}
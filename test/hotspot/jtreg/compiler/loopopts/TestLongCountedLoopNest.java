@@ -0,0 +1,160 @@
+/*
+ * Copyright (c) 2026, Alibaba Group Holding Limited. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+/*
+ * @test
+ * @summary long indexed loops transformed into a loop nest must keep their trip count
+ * @requires vm.compiler2.enabled
+ * @run main/othervm -XX:+UnlockExperimentalVMOptions -XX:+UseLongCountedLoops
+ *                   -XX:-BackgroundCompilation -XX:-UseOnStackReplacement
+ *                   compiler.loopopts.TestLongCountedLoopNest
+ */
+
+/*
+ * @test
+ * @summary accumulators and memory state must survive the outer loop of the nest
+ * @requires vm.compiler2.enabled & vm.debug
+ * @run main/othervm -XX:+UnlockExperimentalVMOptions -XX:+UseLongCountedLoops
+ *                   -XX:StressLongCountedLoop=200000
+ *                   -XX:-BackgroundCompilation -XX:-UseOnStackReplacement
+ *                   compiler.loopopts.TestLongCountedLoopNest
+ */
+
+/*
+ * @test
+ * @summary a long indexed loop must be nested and its inner loop converted to a counted loop
+ * @requires vm.compiler2.enabled & vm.debug
+ * @library /test/lib
+ * @modules java.base/jdk.internal.misc
+ *          java.management
+ * @run driver compiler.loopopts.TestLongCountedLoopNest trace
+ */
+
+package compiler.loopopts;
+
+import jdk.test.lib.process.OutputAnalyzer;
+import jdk.test.lib.process.ProcessTools;
+
+public class TestLongCountedLoopNest {
+
+    static long countUp(long start, long stop, int[] arr) {
+        long sum = 0;
+        for (long i = start; i < stop; i++) {
+            sum += arr[(int)(i & 0xff)];
+        }
+        return sum;
+    }
+
+    static long countUpInclusive(long start, long stop) {
+        long n = 0;
+        for (long i = start; i <= stop; i += 3) {
+            n++;
+        }
+        return n;
+    }
+
+    static long countDown(long start, long stop) {
+        long n = 0;
+        for (long i = start; i > stop; i -= 7) {
+            n += i;
+        }
+        return n;
+    }
+
+    static long field;
+
+    // The store to field is carried by the memory phi of the loop head.
+    static void storeUp(long start, long stop) {
+        for (long i = start; i < stop; i++) {
+            field += 2;
+        }
+    }
+
+    static long expectedUp(long start, long stop, int[] arr) {
+        long sum = 0;
+        for (long i = start; i < stop; i++) {
+            sum += arr[(int)(i & 0xff)];
+        }
+        return sum;
+    }
+
+    static void check(long expected, long actual, String what) {
+        if (expected != actual) {
+            throw new RuntimeException(what + ": expected " + expected + " but got " + actual);
+        }
+    }
+
+    // Compile countUp() alone in a child VM and check from the loop opts
+    // trace that its loop became a nest with a counted inner loop.
+    static void checkTrace() throws Exception {
+        ProcessBuilder pb = ProcessTools.createJavaProcessBuilder(true,
+            "-XX:+UnlockExperimentalVMOptions", "-XX:+UseLongCountedLoops",
+            "-XX:-TieredCompilation", "-Xbatch", "-XX:-UseOnStackReplacement",
+            "-XX:CompileCommand=quiet",
+            "-XX:CompileCommand=compileonly," + TestLongCountedLoopNest.class.getName() + "::countUp",
+            "-XX:+TraceLoopOpts",
+            TestLongCountedLoopNest.class.getName());
+        OutputAnalyzer output = new OutputAnalyzer(pb.start());
+        output.shouldHaveExitValue(0);
+        output.shouldMatch("(?m)^LongCounted\\s+Loop: N\\d+/N\\d+");
+        output.shouldMatch("(?m)^Counted\\s+Loop: N\\d+/N\\d+");
+    }
+
+    public static void main(String[] args) throws Exception {
+        if (args.length > 0 && args[0].equals("trace")) {
+            checkTrace();
+            return;
+        }
+        int[] arr = new int[256];
+        for (int i = 0; i < arr.length; i++) {
+            arr[i] = i * 31;
+        }
+        long[][] bounds = {
+            { 0, 1000 },
+            { 1000, 0 },
+            { -5000, 5000 },
+            { Long.MAX_VALUE - 100, Long.MAX_VALUE },
+            { Long.MIN_VALUE, Long.MIN_VALUE + 100 },
+            { Long.MAX_VALUE, Long.MIN_VALUE },
+        };
+        long expected0 = expectedUp(0, 1000, arr);
+        for (int i = 0; i < 20_000; i++) {
+            check(expected0, countUp(0, 1000, arr), "countUp warmup");
+            countUpInclusive(0, 100);
+            countDown(100, 0);
+            storeUp(0, 100);
+        }
+        for (long[] b : bounds) {
+            check(expectedUp(b[0], b[1], arr), countUp(b[0], b[1], arr), "countUp");
+        }
+        check(0, countUpInclusive(10, 0), "countUpInclusive no iteration");
+        check(34, countUpInclusive(0, 99), "countUpInclusive");
+        check((100 + 93 + 86 + 79 + 72 + 65 + 58 + 51 + 44 + 37 + 30 + 23 + 16 + 9 + 2),
+              countDown(100, 0), "countDown");
+        // Trip count larger than what an int inner loop can cover
+        field = 0;
+        storeUp(-(1L << 31), 1L << 31);
+        check(1L << 33, field, "storeUp long trip count");
+        check((1L << 32) / 3 + 1, countUpInclusive(0, 1L << 32), "countUpInclusive long trip count");
+    }
+}
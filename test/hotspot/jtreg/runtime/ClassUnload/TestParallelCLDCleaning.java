@@ -0,0 +1,63 @@
+/*
+ * Copyright (c) 2026, Alibaba Group Holding Limited. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+/*
+ * @test
+ * @summary unload many class loaders with G1, check the class unloading phases are logged
+ * @requires vm.gc.G1
+ * @library /test/lib /
+ * @modules java.base/jdk.internal.misc
+ *          java.management
+ * @build runtime.testlibrary.PayloadLoader
+ * @run main runtime.ClassUnload.TestParallelCLDCleaning
+ */
+
+package runtime.ClassUnload;
+
+import jdk.test.lib.process.OutputAnalyzer;
+import jdk.test.lib.process.ProcessTools;
+import runtime.testlibrary.PayloadLoader;
+
+public class TestParallelCLDCleaning {
+    public static class Unloader {
+        public static void main(String[] args) throws Exception {
+            // Keep some loaders alive, so the cleaning has live loaders to walk.
+            PayloadLoader[] alive = PayloadLoader.defineMany(10_000, 10);
+            System.gc();
+            System.out.println("alive loaders: " + alive.length);
+        }
+    }
+
+    public static void main(String[] args) throws Exception {
+        ProcessBuilder pb = ProcessTools.createJavaProcessBuilder(true,
+            "-XX:+UseG1GC",
+            "-XX:ParallelGCThreads=4",
+            "-Xlog:gc+phases=debug",
+            "-Xlog:class+loader+data=debug",
+            Unloader.class.getName());
+        OutputAnalyzer output = new OutputAnalyzer(pb.start());
+        output.shouldHaveExitValue(0);
+        output.shouldContain("Module and Package Info");
+        output.shouldContain("Purge ClassLoaderData");
+        output.shouldMatch("purge: loaders deleted [1-9]\\d*");
+    }
+}
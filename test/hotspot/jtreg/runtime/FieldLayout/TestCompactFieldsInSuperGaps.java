@@ -0,0 +1,78 @@
+/*
+ * Copyright (c) 2026, Alibaba Group Holding Limited. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+/*
+ * @test
+ * @summary check CompactFieldsInSuperGaps allocates fields in the gaps of the superclass layout
+ * @library /test/lib
+ * @modules java.base/jdk.internal.misc
+ *          java.base/jdk.internal.vm.annotation
+ * @run main/othervm -XX:+CompactFieldsInSuperGaps -XX:-RestrictContended
+ *                   runtime.FieldLayout.TestCompactFieldsInSuperGaps
+ * @run main/othervm -XX:+CompactFieldsInSuperGaps -XX:-RestrictContended
+ *                   -XX:+UnlockDiagnosticVMOptions -XX:+PrintFieldLayout
+ *                   runtime.FieldLayout.TestCompactFieldsInSuperGaps
+ */
+
+package runtime.FieldLayout;
+
+import jdk.internal.misc.Unsafe;
+
+public class TestCompactFieldsInSuperGaps {
+    static class Base {
+        byte a;
+    }
+
+    static class ByteSub extends Base {
+        byte b;
+    }
+
+    static class ShortSub extends Base {
+        short s;
+    }
+
+    static class Contended extends Base {
+        @jdk.internal.vm.annotation.Contended
+        byte c;
+    }
+
+    static final Unsafe UNSAFE = Unsafe.getUnsafe();
+
+    static long offset(Class<?> c, String name) {
+        return UNSAFE.objectFieldOffset(c, name);
+    }
+
+    static void check(long actual, long expected, String what) {
+        if (actual != expected) {
+            throw new RuntimeException(what + ": offset " + actual + ", expected " + expected);
+        }
+    }
+
+    public static void main(String[] args) throws Exception {
+        long a = offset(Base.class, "a");
+        check(offset(ByteSub.class, "b"), a + 1, "ByteSub.b");
+        check(offset(ShortSub.class, "s"), a + 2, "ShortSub.s");
+        if (offset(Contended.class, "c") <= a + 1) {
+            throw new RuntimeException("Contended.c must not be allocated in the gap");
+        }
+    }
+}
@@ -0,0 +1,90 @@
+/*
+ * Copyright (c) 2026, Alibaba Group Holding Limited. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+/*
+ * @test
+ * @summary unload classes with MetaspaceUncommitFreeChunks, check VM.metaspace reports
+ *          uncommitted free chunks and that the memory left the resident set
+ * @library /test/lib /
+ * @modules java.base/jdk.internal.misc
+ *          java.management
+ * @build runtime.testlibrary.PayloadLoader
+ * @run main/othervm -XX:+MetaspaceUncommitFreeChunks -XX:+UseSerialGC
+ *                   -Xms64m -Xmx64m -XX:+AlwaysPreTouch
+ *                   runtime.Metaspace.TestUncommitFreeChunks
+ */
+
+package runtime.Metaspace;
+
+import java.nio.file.Files;
+import java.nio.file.Paths;
+import java.util.regex.Matcher;
+import java.util.regex.Pattern;
+
+import jdk.test.lib.Platform;
+import jdk.test.lib.dcmd.PidJcmdExecutor;
+import jdk.test.lib.process.OutputAnalyzer;
+import runtime.testlibrary.PayloadLoader;
+
+public class TestUncommitFreeChunks {
+    // Resident set size of this process in bytes, from /proc/self/status
+    static long rss() throws Exception {
+        for (String line : Files.readAllLines(Paths.get("/proc/self/status"))) {
+            if (line.startsWith("VmRSS:")) {
+                return Long.parseLong(line.replaceAll("[^0-9]", "")) * 1024;
+            }
+        }
+        throw new RuntimeException("no VmRSS in /proc/self/status");
+    }
+
+    public static void main(String[] args) throws Exception {
+        PayloadLoader.defineMany(10_000, 0);
+        // The heap is pretouched, so the collection does not add to the resident set.
+        long rssBefore = Platform.isLinux() ? rss() : 0;
+        System.gc();
+        long rssAfter = Platform.isLinux() ? rss() : 0;
+
+        PidJcmdExecutor executor = new PidJcmdExecutor();
+        OutputAnalyzer output = executor.execute("VM.metaspace scale=1");
+        output.shouldContain("Chunk freelist");
+        output.shouldMatch("Below medium size: .*\\(.*%\\)");
+
+        // One line for the non-class space and one for the class space
+        long uncommitted = 0;
+        Matcher m = Pattern.compile("Uncommitted: +(\\d+) bytes").matcher(output.getStdout());
+        while (m.find()) {
+            uncommitted += Long.parseLong(m.group(1));
+        }
+        System.out.println("uncommitted: " + uncommitted + " bytes, resident set " +
+                           rssBefore + " -> " + rssAfter + " bytes");
+        if (uncommitted == 0) {
+            throw new RuntimeException("no free chunk memory was uncommitted after unloading");
+        }
+        // Purged virtual space nodes shrink the resident set as well, so this
+        // is only a lower bound. Half of it leaves room for other allocations.
+        if (Platform.isLinux() && rssBefore - rssAfter < uncommitted / 2) {
+            throw new RuntimeException("resident set shrank by " + (rssBefore - rssAfter) +
+                                       " bytes, less than half of the " + uncommitted +
+                                       " uncommitted bytes");
+        }
+    }
+}
@@ -0,0 +1,122 @@
+/*
+ * Copyright (c) 2026, Alibaba Group Holding Limited. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+/*
+ * @test
+ * @summary inflate, hash and contend on monitors while the service thread deflates them
+ * @run main/othervm -XX:+UnlockExperimentalVMOptions -XX:+AsyncDeflateIdleMonitors
+ *                   -XX:AsyncDeflationInterval=1 -XX:MonitorUsedDeflationThreshold=1
+ *                   runtime.Monitor.TestAsyncMonitorDeflation
+ * @run main/othervm -XX:+UnlockExperimentalVMOptions -XX:+AsyncDeflateIdleMonitors
+ *                   -XX:AsyncDeflationInterval=1 -XX:MonitorUsedDeflationThreshold=1
+ *                   -XX:MonitorBound=1000 -Xlog:monitorinflation=debug:file=deflation.log
+ *                   runtime.Monitor.TestAsyncMonitorDeflation
+ * @run main/othervm -XX:+UnlockExperimentalVMOptions -XX:+AsyncDeflateIdleMonitors
+ *                   -XX:AsyncDeflationInterval=1 -XX:MonitorUsedDeflationThreshold=0
+ *                   -Xlog:monitorinflation=debug:file=deflation-after-safepoint.log
+ *                   runtime.Monitor.TestAsyncMonitorDeflation deflation-after-safepoint.log
+ */
+
+package runtime.Monitor;
+
+import java.nio.file.Files;
+import java.nio.file.Paths;
+
+public class TestAsyncMonitorDeflation {
+    static final int THREADS = 8;
+    static final int OBJECTS = 4096;
+    static final int ITERATIONS = 200;
+
+    static final Object[] locks = new Object[OBJECTS];
+    static final int[] hashes = new int[OBJECTS];
+    static final long[] counters = new long[OBJECTS];
+    static volatile Throwable failure;
+
+    public static void main(String[] args) throws Exception {
+        for (int i = 0; i < OBJECTS; i++) {
+            locks[i] = new Object();
+            hashes[i] = System.identityHashCode(locks[i]);
+        }
+
+        Thread[] threads = new Thread[THREADS];
+        for (int t = 0; t < THREADS; t++) {
+            threads[t] = new Thread(() -> {
+                try {
+                    run();
+                } catch (Throwable e) {
+                    failure = e;
+                }
+            });
+            threads[t].start();
+        }
+        for (Thread t : threads) {
+            t.join();
+        }
+        if (failure != null) {
+            throw new RuntimeException(failure);
+        }
+
+        for (int i = 0; i < OBJECTS; i++) {
+            if (counters[i] != (long)THREADS * ITERATIONS) {
+                throw new RuntimeException("lost update on lock " + i + ": " + counters[i]);
+            }
+        }
+
+        if (args.length > 0) {
+            checkDeflatedAfterSafepoint(args[0]);
+        }
+    }
+
+    // Without MonitorUsedDeflationThreshold the idle monitors are still
+    // deflated after a safepoint, as they would be by the safepoint cleanup.
+    static void checkDeflatedAfterSafepoint(String log) throws Exception {
+        System.gc();
+        for (int i = 0; i < 100; i++) {
+            for (String line : Files.readAllLines(Paths.get(log))) {
+                if (line.matches(".*Async deflation: .* deflated=[1-9].*")) {
+                    return;
+                }
+            }
+            Thread.sleep(100);
+        }
+        throw new RuntimeException("idle monitors were not deflated after a safepoint");
+    }
+
+    static void run() throws InterruptedException {
+        for (int it = 0; it < ITERATIONS; it++) {
+            for (int i = 0; i < OBJECTS; i++) {
+                Object lock = locks[i];
+                synchronized (lock) {
+                    counters[i]++;
+                    if ((it & 7) == 0 && (i & 255) == 0) {
+                        // wait() always inflates, contention does the rest
+                        lock.wait(1);
+                    }
+                }
+                if (System.identityHashCode(lock) != hashes[i]) {
+                    throw new RuntimeException("identity hash of lock " + i + " changed");
+                }
+            }
+        }
+    }
+}
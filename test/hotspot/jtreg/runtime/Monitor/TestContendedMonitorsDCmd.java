@@ -0,0 +1,96 @@
+/*
+ * Copyright (c) 2026, Alibaba Group Holding Limited. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+/*
+ * @test
+ * @summary Thread.contended_monitors prints the statistics of a contended monitor
+ * @library /test/lib
+ * @modules java.base/jdk.internal.misc
+ *          java.management
+ * @run main/othervm -XX:+UseAdaptiveMonitorSpinning runtime.Monitor.TestContendedMonitorsDCmd
+ */
+
+package runtime.Monitor;
+
+import jdk.test.lib.dcmd.PidJcmdExecutor;
+import jdk.test.lib.process.OutputAnalyzer;
+
+public class TestContendedMonitorsDCmd {
+    static class HotLock {}
+
+    static final HotLock lock = new HotLock();
+    static volatile boolean done;
+    static long counter;
+
+    public static void main(String[] args) throws Exception {
+        // A waiter keeps the monitor inflated and busy, so it is not deflated
+        // before the statistics are printed.
+        Thread waiter = new Thread(() -> {
+            synchronized (lock) {
+                while (!done) {
+                    try {
+                        lock.wait();
+                    } catch (InterruptedException e) {
+                    }
+                }
+            }
+        });
+        waiter.start();
+
+        Thread[] workers = new Thread[4];
+        for (int i = 0; i < workers.length; i++) {
+            workers[i] = new Thread(() -> {
+                while (!done) {
+                    synchronized (lock) {
+                        counter++;
+                        if ((counter & 0xFF) == 0) {
+                            try {
+                                Thread.sleep(1);
+                            } catch (InterruptedException e) {
+                            }
+                        }
+                    }
+                }
+            });
+            workers[i].start();
+        }
+
+        Thread.sleep(2000);
+        OutputAnalyzer output = new PidJcmdExecutor().execute("Thread.contended_monitors -n 5");
+
+        done = true;
+        synchronized (lock) {
+            lock.notifyAll();
+        }
+        for (Thread t : workers) {
+            t.join();
+        }
+        waiter.join();
+
+        output.shouldContain("contended monitors, sorted by total wait time");
+        output.shouldContain("TestContendedMonitorsDCmd$HotLock");
+        output.shouldContain("contended enters: ");
+        output.shouldMatch("wait \\(us\\):.*:\\d+");
+        output.shouldMatch("policy: (spin|yield|park)");
+    }
+}
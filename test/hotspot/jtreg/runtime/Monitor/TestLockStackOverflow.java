@@ -0,0 +1,74 @@
+/*
+ * Copyright (c) 2026, Alibaba Group Holding Limited. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+/*
+ * @test
+ * @summary nest more fast-locks than fit on the lock-stack and check that the oldest one is inflated
+ * @requires os.arch=="amd64" | os.arch=="x86_64" | os.arch=="aarch64"
+ * @library /test/lib
+ * @run driver runtime.Monitor.TestLockStackOverflow
+ */
+
+package runtime.Monitor;
+
+import jdk.test.lib.process.OutputAnalyzer;
+import jdk.test.lib.process.ProcessTools;
+
+public class TestLockStackOverflow {
+    static final int DEPTH = 16;
+
+    public static void main(String[] args) throws Exception {
+        if (args.length > 0) {
+            Object[] locks = new Object[DEPTH];
+            for (int i = 0; i < DEPTH; i++) {
+                locks[i] = new Object();
+            }
+            long sum = 0;
+            for (int it = 0; it < 20000; it++) {
+                sum += nest(locks, 0);
+            }
+            System.out.println("sum: " + sum);
+            return;
+        }
+
+        for (String mode : new String[] { "-Xint", "-XX:TieredStopAtLevel=1", "-XX:-TieredCompilation" }) {
+            ProcessBuilder pb = ProcessTools.createJavaProcessBuilder(
+                    "-XX:+UnlockDiagnosticVMOptions", "-XX:+UseAltFastLocking",
+                    "-Xlog:monitorinflation=debug", mode,
+                    TestLockStackOverflow.class.getName(), "run");
+            OutputAnalyzer output = new OutputAnalyzer(pb.start());
+            output.shouldHaveExitValue(0);
+            output.shouldContain("sum: " + 20000L * DEPTH);
+            output.shouldContain("cause Lock Stack Full");
+        }
+    }
+
+    static int nest(Object[] locks, int i) {
+        if (i == locks.length) {
+            return 0;
+        }
+        synchronized (locks[i]) {
+            return 1 + nest(locks, i + 1);
+        }
+    }
+}
@@ -0,0 +1,71 @@
+/*
+ * Copyright (c) 2026, Alibaba Group Holding Limited. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+/*
+ * @test
+ * @summary report the threads that were slowest to reach a safepoint under safepoint+stats logging
+ * @library /test/lib
+ * @run driver runtime.Safepoint.TestTimeToSafepointTopThreads
+ */
+
+package runtime.Safepoint;
+
+import jdk.test.lib.process.OutputAnalyzer;
+import jdk.test.lib.process.ProcessTools;
+
+public class TestTimeToSafepointTopThreads {
+    static volatile boolean done;
+    static long sink;
+
+    public static void main(String[] args) throws Exception {
+        if (args.length > 0) {
+            Thread spinner = new Thread(() -> {
+                long sum = 0;
+                while (!done) {
+                    for (int i = 0; i < 1_000_000; i++) {
+                        sum += i ^ (sum >>> 3);
+                    }
+                }
+                sink = sum;
+            }, "Spinner");
+            spinner.start();
+            for (int i = 0; i < 20; i++) {
+                System.gc();
+                Thread.sleep(10);
+            }
+            done = true;
+            spinner.join();
+            return;
+        }
+
+        ProcessBuilder pb = ProcessTools.createJavaProcessBuilder(
+                "-XX:TimeToSafepointTopThreads=3", "-XX:+TimeToSafepointCodeAttribution",
+                "-Xlog:safepoint+stats=info",
+                TestTimeToSafepointTopThreads.class.getName(), "run");
+        OutputAnalyzer output = new OutputAnalyzer(pb.start());
+        output.shouldHaveExitValue(0);
+        output.shouldMatch("Time to safepoint: .*, \\d+ slowest of \\d+ threads");
+        output.shouldMatch("  1: \\d+ ns, examined \\d+ times, _thread_\\w+ -> _thread_\\w+, stopped in .*");
+        output.shouldContain("thread \"Spinner\"");
+    }
+}
@@ -0,0 +1,60 @@
+/*
+ * Copyright (c) 2026, Alibaba Group Holding Limited. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+/*
+ * @test
+ * @summary create and drop many symbols, check VM.symboltable reports the table and its latency
+ * @library /test/lib
+ * @modules java.base/jdk.internal.misc
+ *          java.management
+ * @run main/othervm -XX:+SymbolTableStatistics runtime.SymbolTable.TestSymbolTableStatistics
+ */
+
+package runtime.SymbolTable;
+
+import jdk.test.lib.dcmd.PidJcmdExecutor;
+import jdk.test.lib.process.OutputAnalyzer;
+
+public class TestSymbolTableStatistics {
+    public static void main(String[] args) throws Exception {
+        // Every lookup of a missing class creates a symbol for its name,
+        // which dies as soon as the lookup fails.
+        for (int i = 0; i < 100_000; i++) {
+            try {
+                Class.forName("runtime.SymbolTable.Missing" + i);
+                throw new RuntimeException("class should not exist");
+            } catch (ClassNotFoundException e) {
+                // expected
+            }
+        }
+        System.gc();
+
+        PidJcmdExecutor executor = new PidJcmdExecutor();
+        OutputAnalyzer output = executor.execute("VM.symboltable");
+        output.shouldContain("SymbolTable statistics:");
+        output.shouldMatch("Lookups +: [1-9]\\d*, avg");
+        output.shouldMatch("Inserts +: [1-9]\\d*, avg");
+
+        output = executor.execute("VM.symboltable -verbose");
+        output.shouldContain("java/lang/Object");
+    }
+}
@@ -0,0 +1,100 @@
+/*
+ * Copyright (c) 2026, Alibaba Group Holding Limited. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+/*
+ * @test
+ * @summary A run with -XX:ArchiveClassesAtExit dumps the classes it loaded,
+ *          and the next run loads them from that archive
+ * @requires vm.cds
+ * @library /test/lib
+ * @run main/othervm runtime.cds.TestArchiveClassesAtExit
+ */
+
+package runtime.cds;
+
+import java.io.File;
+import java.util.ArrayList;
+import java.util.Arrays;
+import java.util.List;
+
+import jdk.test.lib.process.OutputAnalyzer;
+import jdk.test.lib.process.ProcessTools;
+
+public class TestArchiveClassesAtExit {
+    static OutputAnalyzer run(String archive, String... flags) throws Exception {
+        List<String> args = new ArrayList<>();
+        args.add("-XX:ArchiveClassesAtExit=" + archive);
+        args.addAll(Arrays.asList(flags));
+        args.add(Hello.class.getName());
+        ProcessBuilder pb = ProcessTools.createJavaProcessBuilder(true, args.toArray(new String[0]));
+        OutputAnalyzer output = new OutputAnalyzer(pb.start());
+        output.shouldHaveExitValue(0);
+        output.shouldContain("Hello from the archive");
+        return output;
+    }
+
+    static void shouldLoadFromArchive(OutputAnalyzer output) {
+        output.shouldMatch(Hello.class.getName().replace(".", "\\.").replace("$", "\\$")
+                           + " source: shared objects file");
+    }
+
+    public static void main(String[] args) throws Exception {
+        // The dump runs without a shell, so paths with spaces need no quoting
+        File dir = new File("archive dir");
+        dir.mkdirs();
+        String archive = new File(dir, "TestArchiveClassesAtExit.jsa").getAbsolutePath();
+        new File(archive).delete();
+
+        // The first run records the loaded classes and dumps them at exit.
+        // The archive is dumped with the object alignment of this run.
+        OutputAnalyzer output = run(archive, "-XX:ObjectAlignmentInBytes=16", "-Xlog:cds=info");
+        output.shouldContain("Archived loaded classes to " + archive);
+        if (!new File(archive).exists()) {
+            throw new RuntimeException("archive was not created");
+        }
+        // The class list is named after the process and removed after the dump
+        for (String name : dir.list()) {
+            if (name.endsWith(".classlist")) {
+                throw new RuntimeException("class list " + name + " was not removed");
+            }
+        }
+
+        // The next run maps the archive, Hello comes from it.
+        output = run(archive, "-XX:ObjectAlignmentInBytes=16", "-Xshare:on", "-Xlog:class+load=info");
+        shouldLoadFromArchive(output);
+
+        // A run that cannot map the archive dumps it again at exit
+        output = run(archive, "-Xlog:cds=info");
+        output.shouldContain("Unable to map " + archive + ", archiving the loaded classes to it again at exit");
+        output.shouldContain("Archived loaded classes to " + archive);
+
+        output = run(archive, "-Xshare:on", "-Xlog:class+load=info");
+        shouldLoadFromArchive(output);
+    }
+
+    public static class Hello {
+        public static void main(String[] args) {
+            System.out.println("Hello from the archive");
+        }
+    }
+}
@@ -0,0 +1,101 @@
+/*
+ * Copyright (c) 2026, Alibaba Group Holding Limited. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+/*
+ * @test
+ * @summary With -XX:ClassListPrefetchThreads the dump reads the class files
+ *          of the source: entries of the class list ahead of the parser
+ * @requires vm.cds
+ * @library /test/lib
+ * @run main/othervm runtime.cds.TestClassListPrefetch
+ */
+
+package runtime.cds;
+
+import java.io.File;
+import java.io.PrintWriter;
+import java.nio.file.Path;
+import java.nio.file.Paths;
+import java.util.ArrayList;
+import java.util.List;
+
+import jdk.test.lib.process.OutputAnalyzer;
+import jdk.test.lib.process.ProcessTools;
+import jdk.test.lib.util.JarUtils;
+
+public class TestClassListPrefetch {
+    static final Class<?>[] LOADEES = { Loadee0.class, Loadee1.class, Loadee2.class };
+
+    static OutputAnalyzer dump(String classList, String threads) throws Exception {
+        String archive = new File("TestClassListPrefetch.jsa").getAbsolutePath();
+        ProcessBuilder pb = ProcessTools.createJavaProcessBuilder(true,
+            "-Xshare:dump",
+            "-XX:SharedClassListFile=" + classList,
+            "-XX:SharedArchiveFile=" + archive,
+            "-XX:ClassListPrefetchThreads=" + threads,
+            "-Xlog:cds=debug",
+            "-Xlog:class+load=info");
+        return new OutputAnalyzer(pb.start());
+    }
+
+    public static void main(String[] args) throws Exception {
+        Path classes = Paths.get(System.getProperty("test.classes"));
+        List<String> files = new ArrayList<>();
+        for (Class<?> c : LOADEES) {
+            files.add(c.getName().replace('.', '/') + ".class");
+        }
+        Path jar = Paths.get("loadees.jar").toAbsolutePath();
+        JarUtils.createJarFile(jar, classes, files.toArray(new String[0]));
+
+        // The loadees are custom loader classes. The comment, the tab and the
+        // options before source: have to be parsed like the dumping thread does.
+        File classList = new File("TestClassListPrefetch.classlist");
+        try (PrintWriter out = new PrintWriter(classList)) {
+            out.println("java/lang/Object id: 1");
+            out.println("# custom loader classes");
+            int id = 2;
+            for (Class<?> c : LOADEES) {
+                out.println(c.getName().replace('.', '/') + "\tid: " + id++ + " super: 1 source: " + jar);
+            }
+        }
+
+        OutputAnalyzer output = dump(classList.getPath(), "2");
+        output.shouldHaveExitValue(0);
+        output.shouldContain("Prefetched " + LOADEES.length + " class files up to line "
+                             + (LOADEES.length + 2) + " of the class list");
+        for (Class<?> c : LOADEES) {
+            output.shouldMatch(c.getName().replace(".", "\\.").replace("$", "\\$")
+                               + " source: .*loadees\\.jar");
+        }
+
+        // The batch size is a multiple of the thread count, which is bounded
+        output = dump(classList.getPath(), "257");
+        output.shouldNotHaveExitValue(0);
+        output.shouldContain("ClassListPrefetchThreads");
+        output.shouldContain("outside the allowed range");
+    }
+
+    public static class Loadee0 {}
+    public static class Loadee1 {}
+    public static class Loadee2 {}
+}
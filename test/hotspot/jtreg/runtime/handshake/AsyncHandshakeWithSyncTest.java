@@ -0,0 +1,78 @@
+/*
+ * Copyright (c) 2026, Alibaba Group Holding Limited. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+/*
+ * @test
+ * @summary asynchronous handshakes (wisp preemption) still get executed while
+ *          the VM thread processes synchronous handshakes on behalf of threads
+ * @requires os.family == "linux"
+ * @requires os.arch != "riscv64"
+ * @library /testlibrary /test/lib
+ * @build AsyncHandshakeWithSyncTest
+ * @run driver ClassFileInstaller sun.hotspot.WhiteBox
+ *                              sun.hotspot.WhiteBox$WhiteBoxPermission
+ * @run main/othervm -Xbootclasspath/a:. -XX:+UnlockDiagnosticVMOptions -XX:+WhiteBoxAPI
+ *                   -XX:+UnlockExperimentalVMOptions -XX:+EnableCoroutine
+ *                   -Dcom.alibaba.wisp.transparentWispSwitch=true -Dcom.alibaba.wisp.carrierEngines=1
+ *                   AsyncHandshakeWithSyncTest
+ */
+
+import com.alibaba.wisp.engine.WispEngine;
+
+import java.util.concurrent.CountDownLatch;
+import java.util.concurrent.TimeUnit;
+
+import sun.hotspot.WhiteBox;
+import static jdk.test.lib.Asserts.*;
+
+public class AsyncHandshakeWithSyncTest {
+    static volatile boolean done;
+
+    public static void main(String[] args) throws Exception {
+        WhiteBox wb = WhiteBox.getWhiteBox();
+        // Synchronous handshakes on all threads: the VM thread executes them
+        // for blocked threads, which must not drop their queued preemption.
+        Thread handshaker = new Thread(() -> {
+            while (!done) {
+                wb.handshakeWalkStack(null, true);
+            }
+        });
+        handshaker.setDaemon(true);
+        handshaker.start();
+
+        for (int i = 0; i < 10; i++) {
+            // A spinning task is only preempted through an asynchronous
+            // handshake, the task queued after it runs once that happened.
+            WispEngine.dispatch(AsyncHandshakeWithSyncTest::spin);
+            CountDownLatch latch = new CountDownLatch(1);
+            WispEngine.dispatch(latch::countDown);
+            assertTrue(latch.await(5, TimeUnit.SECONDS), "preemption was lost in round " + i);
+        }
+        done = true;
+        handshaker.join();
+    }
+
+    private static void spin() {
+        while (!done) {}
+    }
+}
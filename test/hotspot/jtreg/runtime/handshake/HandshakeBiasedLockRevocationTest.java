@@ -0,0 +1,71 @@
+/*
+ * Copyright (c) 2026, Alibaba Group Holding Limited. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+/*
+ * @test HandshakeBiasedLockRevocationTest
+ * @summary revoke the bias of a locked object in a handshake with its owner instead of at a safepoint
+ * @library /test/lib
+ * @run driver HandshakeBiasedLockRevocationTest
+ */
+
+import java.util.concurrent.CountDownLatch;
+
+import jdk.test.lib.process.OutputAnalyzer;
+import jdk.test.lib.process.ProcessTools;
+
+public class HandshakeBiasedLockRevocationTest {
+    static final Object lock = new Object();
+    static int counter;
+
+    public static void main(String[] args) throws Exception {
+        if (args.length > 0) {
+            CountDownLatch locked = new CountDownLatch(1);
+            Thread owner = new Thread(() -> {
+                synchronized (lock) {
+                    locked.countDown();
+                    long deadline = System.currentTimeMillis() + 500;
+                    while (System.currentTimeMillis() < deadline) {
+                        counter++;
+                    }
+                }
+            }, "Owner");
+            owner.start();
+            locked.await();
+            // Contending for the lock revokes the owner's bias
+            synchronized (lock) {
+                counter++;
+            }
+            owner.join();
+            return;
+        }
+
+        ProcessBuilder pb = ProcessTools.createJavaProcessBuilder(
+                "-XX:+UseBiasedLocking", "-XX:BiasedLockingStartupDelay=0",
+                "-Xlog:biasedlocking+handshake=info",
+                HandshakeBiasedLockRevocationTest.class.getName(), "run");
+        OutputAnalyzer output = new OutputAnalyzer(pb.start());
+        output.shouldHaveExitValue(0);
+        output.shouldContain("to revoke object");
+        output.shouldContain("Revoking bias in handshake with thread");
+    }
+}
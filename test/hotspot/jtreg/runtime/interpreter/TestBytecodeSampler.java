@@ -0,0 +1,69 @@
+/*
+ * Copyright (c) 2026, Alibaba Group Holding Limited. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+/*
+ * @test
+ * @summary sample the bytecodes executed by interpreted threads and report them with jcmd
+ * @library /test/lib
+ * @modules java.base/jdk.internal.misc
+ *          java.management
+ * @run main/othervm -Xint -XX:BytecodeSamplingInterval=1 runtime.interpreter.TestBytecodeSampler
+ * @run main/othervm -Xint -XX:BytecodeSamplingInterval=1500 runtime.interpreter.TestBytecodeSampler exit
+ */
+
+package runtime.interpreter;
+
+import jdk.test.lib.dcmd.PidJcmdExecutor;
+import jdk.test.lib.process.OutputAnalyzer;
+
+public class TestBytecodeSampler {
+    static long sink;
+
+    static long spin(int n) {
+        long sum = 0;
+        for (int i = 0; i < n; i++) {
+            sum += i ^ (sum >>> 3);
+        }
+        return sum;
+    }
+
+    public static void main(String[] args) throws Exception {
+        long deadline = System.currentTimeMillis() + 2000;
+        while (System.currentTimeMillis() < deadline) {
+            sink += spin(100_000);
+        }
+        if (args.length > 0 && args[0].equals("exit")) {
+            // Intervals of a second or more, and stopping the sampler at exit
+            return;
+        }
+
+        PidJcmdExecutor executor = new PidJcmdExecutor();
+        OutputAnalyzer output = executor.execute("Interpreter.bytecode_samples -n=5");
+        output.shouldMatch("Bytecode samples: \\d+ at \\d+ distinct bytecodes");
+        output.shouldContain("runtime.interpreter.TestBytecodeSampler.spin(I)J");
+
+        output = executor.execute("Interpreter.bytecode_samples -reset");
+        output = executor.execute("Interpreter.bytecode_samples");
+        output.shouldNotContain("runtime.interpreter.TestBytecodeSampler.spin(I)J");
+    }
+}
@@ -0,0 +1,171 @@
+/*
+ * Copyright (c) 2026, Alibaba Group Holding Limited. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+/*
+ * @test
+ * @summary iload, iload, if_icmp<cond> sequences fused by the Rewriter branch like the original bytecodes
+ * @requires os.arch=="amd64" | os.arch=="x86_64"
+ * @library /test/lib
+ * @modules java.base/jdk.internal.misc
+ *          java.management
+ * @run main/othervm -Xint -XX:+RewriteFusedBytecodes runtime.interpreter.TestFusedBytecodes run
+ * @run main/othervm -XX:+RewriteFusedBytecodes -XX:-BackgroundCompilation runtime.interpreter.TestFusedBytecodes run
+ * @run driver runtime.interpreter.TestFusedBytecodes
+ */
+
+/*
+ * @test
+ * @summary the interpreter executes the fused bytecodes
+ * @requires os.arch=="amd64" | os.arch=="x86_64"
+ * @requires vm.debug
+ * @library /test/lib
+ * @modules java.base/jdk.internal.misc
+ *          java.management
+ * @run driver runtime.interpreter.TestFusedBytecodes histogram
+ */
+
+package runtime.interpreter;
+
+import jdk.test.lib.process.OutputAnalyzer;
+import jdk.test.lib.process.ProcessTools;
+
+public class TestFusedBytecodes {
+    // Each comparison of two int locals compiles to iload_<n>, iload_<n>, if_icmp<cond>
+    static int compare(int a, int b) {
+        int r = 0;
+        if (a == b) r |= 1;
+        if (a != b) r |= 2;
+        if (a <  b) r |= 4;
+        if (a >= b) r |= 8;
+        if (a >  b) r |= 16;
+        if (a <= b) r |= 32;
+        return r;
+    }
+
+    // a is local 3 and b local 4: iload_3, iload, if_icmp<cond> and
+    // iload, iload_3, if_icmp<cond>
+    static int compareMixed(int p0, int p1, int p2, int a, int b) {
+        int r = 0;
+        if (a == b) r |= 1;
+        if (a != b) r |= 2;
+        if (a <  b) r |= 4;
+        if (b <= a) r |= 8;
+        if (b <  a) r |= 16;
+        if (a <= b) r |= 32;
+        return r;
+    }
+
+    // a is local 4 and b local 5: iload, iload, if_icmp<cond>
+    static int compareWide(long p0, long p2, int a, int b) {
+        int r = 0;
+        if (a == b) r |= 1;
+        if (a != b) r |= 2;
+        if (a <  b) r |= 4;
+        if (a >= b) r |= 8;
+        if (a >  b) r |= 16;
+        if (a <= b) r |= 32;
+        return r;
+    }
+
+    // The loop condition is a backward branch of a fused sequence
+    static int count(int from, int to) {
+        int n = 0;
+        for (int i = from; i < to; i++) {
+            n++;
+        }
+        return n;
+    }
+
+    static void check(int a, int b) {
+        int expected = (a == b ? 1 : 0) | (a != b ? 2 : 0) |
+                       (Integer.compare(a, b) < 0 ? 4 : 0) | (Integer.compare(a, b) >= 0 ? 8 : 0) |
+                       (Integer.compare(a, b) > 0 ? 16 : 0) | (Integer.compare(a, b) <= 0 ? 32 : 0);
+        int actual = compare(a, b);
+        if (actual != expected) {
+            throw new RuntimeException("compare(" + a + ", " + b + ") = " + actual + ", expected " + expected);
+        }
+        actual = compareMixed(0, 0, 0, a, b);
+        if (actual != expected) {
+            throw new RuntimeException("compareMixed(" + a + ", " + b + ") = " + actual + ", expected " + expected);
+        }
+        actual = compareWide(0, 0, a, b);
+        if (actual != expected) {
+            throw new RuntimeException("compareWide(" + a + ", " + b + ") = " + actual + ", expected " + expected);
+        }
+    }
+
+    static void run() {
+        int[] values = { Integer.MIN_VALUE, -1, 0, 1, 42, Integer.MAX_VALUE };
+        for (int iter = 0; iter < 1000; iter++) {
+            for (int a : values) {
+                for (int b : values) {
+                    check(a, b);
+                }
+            }
+        }
+        int n = count(-50_000, 50_000);
+        if (n != 100_000) {
+            throw new RuntimeException("count = " + n);
+        }
+    }
+
+    static OutputAnalyzer runFused(String... flags) throws Exception {
+        String[] args = new String[flags.length + 4];
+        args[0] = "-Xint";
+        args[1] = "-XX:+RewriteFusedBytecodes";
+        System.arraycopy(flags, 0, args, 2, flags.length);
+        args[flags.length + 2] = TestFusedBytecodes.class.getName();
+        args[flags.length + 3] = "run";
+        OutputAnalyzer output = new OutputAnalyzer(ProcessTools.createJavaProcessBuilder(args).start());
+        output.shouldHaveExitValue(0);
+        return output;
+    }
+
+    public static void main(String[] args) throws Exception {
+        if (args.length > 0 && args[0].equals("run")) {
+            run();
+        } else if (args.length > 0 && args[0].equals("histogram")) {
+            // Each fused form is executed, not just rewritten
+            OutputAnalyzer output = runFused("-XX:+PrintBytecodeHistogram");
+            output.shouldMatch("\\d+ .* fast_iload_0_if_icmp");
+            output.shouldMatch("\\d+ .* fast_iload_3_if_icmp");
+            output.shouldMatch("\\d+ .* fast_iload_if_icmp");
+        } else {
+            String compare = "of runtime.interpreter.TestFusedBytecodes.compare(II)I";
+            String mixed = "of runtime.interpreter.TestFusedBytecodes.compareMixed(IIIII)I";
+            String wide = "of runtime.interpreter.TestFusedBytecodes.compareWide(JJII)I";
+            String count = "of runtime.interpreter.TestFusedBytecodes.count(II)I";
+            OutputAnalyzer output = runFused("-Xlog:interpreter=trace");
+            output.shouldMatch("Fused iload_0, iload_1, if_icmpne at bci \\d+ " + compare);
+            output.shouldMatch("Fused iload_0, iload_1, if_icmpge at bci \\d+ " + compare);
+            output.shouldMatch("Fused iload_3, iload, if_icmpne at bci \\d+ " + mixed);
+            output.shouldMatch("Fused iload, iload_3, if_icmpgt at bci \\d+ " + mixed);
+            output.shouldMatch("Fused iload, iload, if_icmple at bci \\d+ " + wide);
+            output.shouldMatch("Fused iload_3, iload_1, if_icmpge at bci \\d+ " + count);
+
+            // Nothing is fused without the flag
+            output = runFused("-XX:-RewriteFusedBytecodes", "-Xlog:interpreter=trace");
+            output.shouldNotContain("Fused ");
+        }
+    }
+}
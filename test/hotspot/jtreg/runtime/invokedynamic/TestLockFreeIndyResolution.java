@@ -0,0 +1,189 @@
+/*
+ * Copyright (c) 2026, Alibaba Group Holding Limited. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+/*
+ * @test
+ * @summary Threads racing to resolve the same invokedynamic call sites all
+ *          see the same call site target with -XX:+LockFreeIndyResolution
+ * @library /test/lib
+ * @modules java.base/jdk.internal.misc
+ *          java.base/jdk.internal.org.objectweb.asm
+ *          java.management
+ * @run driver runtime.invokedynamic.TestLockFreeIndyResolution
+ */
+
+package runtime.invokedynamic;
+
+import java.lang.invoke.CallSite;
+import java.lang.invoke.ConstantCallSite;
+import java.lang.invoke.MethodHandles;
+import java.lang.invoke.MethodType;
+import java.lang.reflect.Method;
+import java.util.concurrent.CountDownLatch;
+import java.util.concurrent.CyclicBarrier;
+import java.util.function.Supplier;
+
+import jdk.internal.org.objectweb.asm.ClassWriter;
+import jdk.internal.org.objectweb.asm.Handle;
+import jdk.internal.org.objectweb.asm.MethodVisitor;
+import jdk.internal.org.objectweb.asm.Opcodes;
+import jdk.test.lib.process.OutputAnalyzer;
+import jdk.test.lib.process.ProcessTools;
+
+public class TestLockFreeIndyResolution {
+    static final int THREADS = 16;
+
+    static final String PACKAGE = TestLockFreeIndyResolution.class.getPackageName();
+    static final String LATCHED_SITE = PACKAGE + ".LatchedCallSite";
+
+    static final Object[] lambdas = new Object[THREADS];
+    static final String[] strings = new String[THREADS];
+    static final Object[] targets = new Object[THREADS];
+
+    static void resolve(int i) {
+        // Each call site below is resolved for the first time by all threads at once.
+        Supplier<String> s = () -> "lambda";
+        lambdas[i] = s;
+        strings[i] = "concat" + i + s.get();
+    }
+
+    // Bootstrap method of the only call site of LatchedCallSite. No thread
+    // returns from it before all threads entered it, so all of them try to
+    // publish their call site and all but one lose the race.
+    static final CountDownLatch bootstrapped = new CountDownLatch(THREADS);
+
+    public static CallSite bootstrap(MethodHandles.Lookup lookup, String name, MethodType type) throws Exception {
+        bootstrapped.countDown();
+        bootstrapped.await();
+        return new ConstantCallSite(MethodHandles.constant(Object.class, new Object()).asType(type));
+    }
+
+    // public class LatchedCallSite {
+    //     public static Object get() { return <invokedynamic get, bootstrap()>; }
+    // }
+    static Method defineLatchedCallSite() throws Exception {
+        ClassWriter cw = new ClassWriter(ClassWriter.COMPUTE_FRAMES | ClassWriter.COMPUTE_MAXS);
+        cw.visit(Opcodes.V1_8, Opcodes.ACC_PUBLIC | Opcodes.ACC_SUPER, LATCHED_SITE.replace('.', '/'),
+                 null, "java/lang/Object", null);
+        MethodType bsmType = MethodType.methodType(CallSite.class, MethodHandles.Lookup.class,
+                                                   String.class, MethodType.class);
+        Handle bsm = new Handle(Opcodes.H_INVOKESTATIC, TestLockFreeIndyResolution.class.getName().replace('.', '/'),
+                                "bootstrap", bsmType.toMethodDescriptorString(), false);
+        MethodVisitor mv = cw.visitMethod(Opcodes.ACC_PUBLIC | Opcodes.ACC_STATIC, "get",
+                                          "()Ljava/lang/Object;", null, null);
+        mv.visitCode();
+        mv.visitInvokeDynamicInsn("get", "()Ljava/lang/Object;", bsm);
+        mv.visitInsn(Opcodes.ARETURN);
+        mv.visitMaxs(0, 0);
+        mv.visitEnd();
+        cw.visitEnd();
+        Class<?> c = MethodHandles.lookup().defineClass(cw.toByteArray());
+        return c.getMethod("get");
+    }
+
+    static OutputAnalyzer run(String flag) throws Exception {
+        ProcessBuilder pb = ProcessTools.createJavaProcessBuilder(true,
+            "--add-exports", "java.base/jdk.internal.org.objectweb.asm=ALL-UNNAMED",
+            flag,
+            "-Xlog:constantpool+resolve=debug",
+            TestLockFreeIndyResolution.class.getName(),
+            "run");
+        OutputAnalyzer output = new OutputAnalyzer(pb.start());
+        output.shouldHaveExitValue(0);
+        return output;
+    }
+
+    static int count(OutputAnalyzer output, String regex) {
+        int n = 0;
+        for (String line : output.asLines()) {
+            if (line.matches(".*" + regex + ".*")) {
+                n++;
+            }
+        }
+        return n;
+    }
+
+    public static void main(String[] args) throws Exception {
+        if (args.length > 0) {
+            race();
+            return;
+        }
+
+        final String claimed = "Claimed invokedynamic call site .* of ";
+        final String waiting = "Waiting for another thread to publish invokedynamic call site .* of ";
+
+        OutputAnalyzer output = run("-XX:+LockFreeIndyResolution");
+        output.shouldMatch(claimed + TestLockFreeIndyResolution.class.getName());
+        // Every thread got through the bootstrap method of the latched call
+        // site before any of them tried to publish it.
+        int won = count(output, claimed + LATCHED_SITE);
+        int lost = count(output, waiting + LATCHED_SITE);
+        if (won != 1 || lost != THREADS - 1) {
+            throw new RuntimeException("latched call site claimed " + won + " times, " + lost + " threads waited");
+        }
+
+        output = run("-XX:-LockFreeIndyResolution");
+        output.shouldNotMatch(claimed);
+        output.shouldNotMatch(waiting);
+    }
+
+    static void race() throws Exception {
+        Method latched = defineLatchedCallSite();
+        CyclicBarrier barrier = new CyclicBarrier(THREADS);
+        Throwable[] failures = new Throwable[THREADS];
+        Thread[] threads = new Thread[THREADS];
+        for (int i = 0; i < THREADS; i++) {
+            final int id = i;
+            threads[i] = new Thread(() -> {
+                try {
+                    barrier.await();
+                    resolve(id);
+                    targets[id] = latched.invoke(null);
+                } catch (Throwable t) {
+                    failures[id] = t;
+                }
+            });
+            threads[i].start();
+        }
+        for (int i = 0; i < THREADS; i++) {
+            threads[i].join();
+            if (failures[i] != null) {
+                throw new RuntimeException("thread " + i + " failed", failures[i]);
+            }
+        }
+        // A non-capturing lambda call site links to a single instance.
+        for (int i = 0; i < THREADS; i++) {
+            if (lambdas[i] != lambdas[0]) {
+                throw new RuntimeException("threads linked different lambda instances");
+            }
+            if (!strings[i].equals("concat" + i + "lambda")) {
+                throw new RuntimeException("unexpected string: " + strings[i]);
+            }
+            // Each bootstrap call returned its own target, all threads must
+            // have linked the one that was published.
+            if (targets[i] != targets[0]) {
+                throw new RuntimeException("threads linked different call site targets");
+            }
+        }
+    }
+}
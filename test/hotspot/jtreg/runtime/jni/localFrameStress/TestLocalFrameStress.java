@@ -0,0 +1,84 @@
+/*
+ * Copyright (c) 2026, Alibaba Group Holding Limited. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+/*
+ * @test
+ * @summary JNI local frames pushed and popped by many threads at once, some of
+ *          them short-lived, share the free list of JNI handle blocks
+ * @run main/native TestLocalFrameStress
+ */
+
+import java.util.concurrent.atomic.AtomicInteger;
+
+public class TestLocalFrameStress {
+    static {
+        System.loadLibrary("LocalFrameStress");
+    }
+
+    // Pushes depth nested local frames of capacity references to obj,
+    // returns the number of references that were corrupted
+    static native int pushFrames(Object obj, int depth, int capacity);
+
+    static final int THREADS = 16;
+    static final int ITERATIONS = 2_000;
+
+    static final AtomicInteger errors = new AtomicInteger();
+
+    static void work(int seed, int iterations) {
+        Object obj = new int[] { seed };
+        for (int i = 0; i < iterations; i++) {
+            // Capacities above the block size of 32 take several blocks per frame
+            errors.addAndGet(pushFrames(obj, 1 + (seed + i) % 8, 1 + (seed * 31 + i) % 100));
+        }
+    }
+
+    public static void main(String[] args) throws Exception {
+        Thread[] threads = new Thread[THREADS];
+        for (int t = 0; t < THREADS; t++) {
+            final int seed = t;
+            threads[t] = new Thread(() -> {
+                if (seed % 2 == 0) {
+                    work(seed, ITERATIONS);
+                } else {
+                    // Exiting threads return their blocks to the global free list
+                    for (int i = 0; i < ITERATIONS / 100; i++) {
+                        Thread child = new Thread(() -> work(seed, 100));
+                        child.start();
+                        try {
+                            child.join();
+                        } catch (InterruptedException e) {
+                            throw new RuntimeException(e);
+                        }
+                    }
+                }
+            });
+            threads[t].start();
+        }
+        for (Thread t : threads) {
+            t.join();
+        }
+        if (errors.get() != 0) {
+            throw new RuntimeException(errors.get() + " corrupted local references");
+        }
+    }
+}
@@ -0,0 +1,58 @@
+/*
+ * Copyright (c) 2026, Alibaba Group Holding Limited. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+#include <jni.h>
+
+// Pushes depth nested local frames of capacity refs each, fills them with
+// references to obj and checks the references before popping the frames.
+// Returns the number of references that did not refer to obj.
+static jint push_frames(JNIEnv *env, jobject obj, jint depth, jint capacity) {
+    jint errors = 0;
+    jint i;
+    jobject first;
+    jobject last;
+
+    if (depth == 0) {
+        return 0;
+    }
+    if ((*env)->PushLocalFrame(env, capacity) != 0) {
+        return 1;
+    }
+    first = (*env)->NewLocalRef(env, obj);
+    last = first;
+    for (i = 1; i < capacity; i++) {
+        last = (*env)->NewLocalRef(env, obj);
+    }
+    errors += push_frames(env, obj, depth - 1, capacity);
+    if (!(*env)->IsSameObject(env, first, obj) || !(*env)->IsSameObject(env, last, obj)) {
+        errors++;
+    }
+    (*env)->PopLocalFrame(env, NULL);
+    return errors;
+}
+
+JNIEXPORT jint JNICALL
+Java_TestLocalFrameStress_pushFrames(JNIEnv *env, jclass unused, jobject obj,
+                                     jint depth, jint capacity) {
+    return push_frames(env, obj, depth, capacity);
+}
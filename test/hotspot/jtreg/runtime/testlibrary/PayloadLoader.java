@@ -0,0 +1,73 @@
+/*
+ * Copyright (c) 2026, Alibaba Group Holding Limited. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+package runtime.testlibrary;
+
+import java.io.IOException;
+import java.io.InputStream;
+import java.io.UncheckedIOException;
+
+/**
+ * A class loader that defines its own copy of {@link Payload}, so the class
+ * dies with the loader. Tests use it to fill the metaspace with classes and
+ * loaders that are unloaded by the next full GC.
+ */
+public class PayloadLoader extends ClassLoader {
+    public static class Payload {
+    }
+
+    private static final byte[] BYTES = readPayload();
+
+    private static byte[] readPayload() {
+        try (InputStream in = PayloadLoader.class.getResourceAsStream("PayloadLoader$Payload.class")) {
+            return in.readAllBytes();
+        } catch (IOException e) {
+            throw new UncheckedIOException(e);
+        }
+    }
+
+    public PayloadLoader() {
+        super(null);
+    }
+
+    public Class<?> define() {
+        return defineClass(Payload.class.getName(), BYTES, 0, BYTES.length);
+    }
+
+    /**
+     * Defines the payload in count loaders that become unreachable right away,
+     * and returns every keepEvery'th loader, which stays alive as long as the
+     * caller holds the returned array. keepEvery 0 keeps none.
+     */
+    public static PayloadLoader[] defineMany(int count, int keepEvery) {
+        PayloadLoader[] alive = new PayloadLoader[keepEvery == 0 ? 0 : (count + keepEvery - 1) / keepEvery];
+        for (int i = 0; i < count; i++) {
+            PayloadLoader loader = new PayloadLoader();
+            loader.define();
+            if (keepEvery != 0 && i % keepEvery == 0) {
+                alive[i / keepEvery] = loader;
+            }
+        }
+        return alive;
+    }
+}
@@ -0,0 +1,161 @@
+/*
+ * Copyright (c) 2026, Alibaba Group Holding Limited. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+/*
+ * @test
+ * @summary verify a class, then check a second run skips its verification with the verification cache
+ *          unless the class or one of its superclasses changed
+ * @library /test/lib
+ * @modules java.base/jdk.internal.misc
+ *          java.management
+ * @run driver runtime.verifier.TestVerificationCache
+ */
+
+package runtime.verifier;
+
+import java.io.File;
+import java.nio.file.Files;
+import java.nio.file.Path;
+import java.nio.file.Paths;
+
+import jdk.test.lib.compiler.InMemoryJavaCompiler;
+import jdk.test.lib.process.OutputAnalyzer;
+import jdk.test.lib.process.ProcessTools;
+
+public class TestVerificationCache {
+    static final String PAYLOAD = "runtime.verifier.TestVerificationCache$Payload";
+    static final String SUB = "q.Sub";
+
+    public static class Payload {
+        public static void main(String[] args) {
+            Object o = new StringBuilder("verified");
+            CharSequence cs = (CharSequence) o;
+            System.out.println(cs);
+        }
+    }
+
+    static final String BASE_SOURCE =
+        "package p; public class Base { protected int value() { return %d; } }";
+    static final String SUB_SOURCE =
+        "package q; public class Sub extends p.Base {" +
+        "  public static void main(String[] args) {" +
+        "    System.out.println(\"%s \" + new Sub().value());" +
+        "  }" +
+        "}";
+
+    static OutputAnalyzer run(String cacheFile, String... args) throws Exception {
+        String[] vmArgs = new String[args.length + 3];
+        vmArgs[0] = "-XX:+UseVerificationCache";
+        vmArgs[1] = "-XX:VerificationCacheFile=" + cacheFile;
+        vmArgs[2] = "-Xlog:verification=info";
+        System.arraycopy(args, 0, vmArgs, 3, args.length);
+        ProcessBuilder pb = ProcessTools.createJavaProcessBuilder(true, vmArgs);
+        OutputAnalyzer output = new OutputAnalyzer(pb.start());
+        output.shouldHaveExitValue(0);
+        return output;
+    }
+
+    static void shouldVerify(OutputAnalyzer output, String name) {
+        output.shouldContain("Start class verification for: " + name);
+        output.shouldNotContain("Skipped class verification for: " + name);
+    }
+
+    static void shouldSkip(OutputAnalyzer output, String name) {
+        output.shouldContain("Skipped class verification for: " + name + " (verification cache)");
+        output.shouldNotContain("Start class verification for: " + name);
+    }
+
+    static void writeClass(Path dir, String name, byte[] bytes) throws Exception {
+        Path file = dir.resolve(name.replace('.', File.separatorChar) + ".class");
+        Files.createDirectories(file.getParent());
+        Files.write(file, bytes);
+    }
+
+    // Writes version value of p.Base to dir
+    static String base(String dir, int value) throws Exception {
+        writeClass(Paths.get(dir), "p.Base",
+                   InMemoryJavaCompiler.compile("p.Base", String.format(BASE_SOURCE, value)));
+        return dir;
+    }
+
+    // Writes a q.Sub printing prefix to dir, compiled against the p.Base in baseDir
+    static String sub(String dir, String baseDir, String prefix) throws Exception {
+        writeClass(Paths.get(dir), SUB,
+                   InMemoryJavaCompiler.compile(SUB, String.format(SUB_SOURCE, prefix), "-cp", baseDir));
+        return dir;
+    }
+
+    static File newCache(String name) {
+        File cache = new File(name);
+        cache.delete();
+        return cache;
+    }
+
+    public static void main(String[] args) throws Exception {
+        File cache = newCache("verification.cache");
+
+        OutputAnalyzer output = run(cache.getPath(), PAYLOAD);
+        output.shouldContain("verified");
+        shouldVerify(output, PAYLOAD);
+        if (!cache.exists()) {
+            throw new RuntimeException("verification cache was not written");
+        }
+
+        output = run(cache.getPath(), PAYLOAD);
+        output.shouldContain("verified");
+        shouldSkip(output, PAYLOAD);
+
+        String base1 = base("base1", 1);
+        String base2 = base("base2", 2);
+        String sub1 = sub("sub1", base1, "first");
+        String sub2 = sub("sub2", base1, "second");
+        String sep = File.pathSeparator;
+
+        // A changed class is verified again
+        cache = newCache("changed-class.cache");
+        shouldVerify(run(cache.getPath(), "-cp", sub1 + sep + base1, SUB), SUB);
+        output = run(cache.getPath(), "-cp", sub1 + sep + base1, SUB);
+        output.shouldContain("first 1");
+        shouldSkip(output, SUB);
+        output = run(cache.getPath(), "-cp", sub2 + sep + base1, SUB);
+        output.shouldContain("second 1");
+        shouldVerify(output, SUB);
+
+        // A class with a changed superclass is verified again
+        cache = newCache("changed-super.cache");
+        shouldVerify(run(cache.getPath(), "-cp", sub1 + sep + base1, SUB), SUB);
+        output = run(cache.getPath(), "-cp", sub1 + sep + base2, SUB);
+        output.shouldContain("first 2");
+        shouldVerify(output, SUB);
+
+        // Superclasses of the boot loader that are not in the runtime image
+        // are fingerprinted too
+        cache = newCache("changed-boot-super.cache");
+        shouldVerify(run(cache.getPath(), "-Xbootclasspath/a:" + base1, "-cp", sub1, SUB), SUB);
+        output = run(cache.getPath(), "-Xbootclasspath/a:" + base1, "-cp", sub1, SUB);
+        output.shouldContain("first 1");
+        shouldSkip(output, SUB);
+        output = run(cache.getPath(), "-Xbootclasspath/a:" + base2, "-cp", sub1, SUB);
+        output.shouldContain("first 2");
+        shouldVerify(output, SUB);
+    }
+}
@@ -0,0 +1,101 @@
+/*
+ * Copyright (c) 2026, Alibaba Group Holding Limited. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+package jdk.jfr.event.runtime;
+
+import java.time.Duration;
+import java.util.List;
+import java.util.concurrent.CountDownLatch;
+
+import jdk.jfr.Recording;
+import jdk.jfr.consumer.RecordedClass;
+import jdk.jfr.consumer.RecordedEvent;
+import jdk.test.lib.jfr.Events;
+
+/*
+ * @test
+ * @summary a thread waiting for another thread's <clinit> records a ClassInitializationWait event
+ * @key jfr
+ * @requires vm.hasJFR
+ * @library /test/lib
+ * @run main/othervm jdk.jfr.event.runtime.TestClassInitializationWaitEvent
+ */
+public class TestClassInitializationWaitEvent {
+    private static final String EVENT_NAME = "jdk.ClassInitializationWait";
+    private static final long CLINIT_MILLIS = 500;
+
+    static final CountDownLatch initializing = new CountDownLatch(1);
+
+    static class Slow {
+        static int value;
+
+        static {
+            initializing.countDown();
+            try {
+                Thread.sleep(CLINIT_MILLIS);
+            } catch (InterruptedException e) {
+                throw new RuntimeException(e);
+            }
+            value = 42;
+        }
+    }
+
+    public static void main(String[] args) throws Throwable {
+        Recording recording = new Recording();
+        recording.enable(EVENT_NAME).withThreshold(Duration.ZERO);
+        recording.start();
+
+        Thread initializer = new Thread(() -> Slow.value++, "initializer");
+        Thread waiter = new Thread(() -> {
+            try {
+                initializing.await();
+            } catch (InterruptedException e) {
+                throw new RuntimeException(e);
+            }
+            Slow.value++;
+        }, "waiter");
+        initializer.start();
+        waiter.start();
+        initializer.join();
+        waiter.join();
+
+        recording.stop();
+        List<RecordedEvent> events = Events.fromRecording(recording);
+        boolean found = false;
+        for (RecordedEvent event : events) {
+            System.out.println("Event: " + event);
+            RecordedClass initializedClass = event.getValue("initializedClass");
+            if (initializedClass.getName().equals(Slow.class.getName())) {
+                Events.assertEventThread(event, waiter);
+                if (event.getDuration().toMillis() < CLINIT_MILLIS / 2) {
+                    throw new RuntimeException("Waited only " + event.getDuration() + " for " + Slow.class.getName());
+                }
+                found = true;
+            }
+        }
+        if (!found) {
+            throw new RuntimeException("No " + EVENT_NAME + " event for " + Slow.class.getName());
+        }
+        recording.close();
+    }
+}